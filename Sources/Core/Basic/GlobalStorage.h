@@ -30,7 +30,7 @@ class GlobalStorage
   // Constructor
 
   /// Prevent the singleton class from being inistantiated.
-  private: GlobalStorage() : map(true)
+  private: GlobalStorage() : map(MapIndexType::HASHED)
   {
   }
 
@@ -0,0 +1,139 @@
+/**
+ * @file Core/Basic/NameIndex.h
+ * Contains definition of Basic::NameIndex class.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_BASIC_NAMEINDEX_H
+#define CORE_BASIC_NAMEINDEX_H
+
+#include <algorithm>
+
+namespace Core::Basic
+{
+
+/**
+ * @brief A hashed index of the names of the elements of an array.
+ *
+ * Maps each name to the sorted indices of the array elements having that
+ * name. Elements without names are not indexed. Like SubsetIndex, the owner of
+ * the array must keep this index updated by calling onAdded, onUpdated, and
+ * onRemoved whenever the array changes.
+ */
+class NameIndex
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::unordered_map<Str, std::vector<Int>, std::hash<Str>> indicesByName;
+
+  /// The name of each element, pointing to the keys of indicesByName, or null.
+  private: std::vector<Str const*> names;
+
+
+  //============================================================================
+  // Constructors
+
+  public: NameIndex()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void clear()
+  {
+    this->indicesByName.clear();
+    this->names.clear();
+  }
+
+  public: void onAdded(Int index, Str const *name)
+  {
+    if (static_cast<Word>(index) < this->names.size()) this->shiftIndices(index, 1);
+    this->names.insert(this->names.begin() + index, 0);
+    this->setName(index, name);
+  }
+
+  public: void onUpdated(Int index, Str const *name)
+  {
+    if (static_cast<Word>(index) >= this->names.size()) return;
+    Str const *oldName = this->names[index];
+    if (oldName == 0 && name == 0) return;
+    if (oldName != 0 && name != 0 && *oldName == *name) return;
+    this->unsetName(index);
+    this->setName(index, name);
+  }
+
+  public: void onRemoved(Int index)
+  {
+    if (static_cast<Word>(index) >= this->names.size()) return;
+    this->unsetName(index);
+    this->shiftIndices(index + 1, -1);
+    this->names.erase(this->names.begin() + index);
+  }
+
+  /// Check whether the element at the given index has a name.
+  public: Bool hasName(Int index) const
+  {
+    return static_cast<Word>(index) < this->names.size() && this->names[index] != 0;
+  }
+
+  /// Get the sorted indices of the elements with the given name, or null if none.
+  public: std::vector<Int> const* find(Str const &name) const
+  {
+    auto iter = this->indicesByName.find(name);
+    if (iter == this->indicesByName.end()) return 0;
+    else return &iter->second;
+  }
+
+  private: void setName(Int index, Str const *name)
+  {
+    if (name == 0) return;
+    auto iter = this->indicesByName.emplace(*name, std::vector<Int>()).first;
+    auto &indices = iter->second;
+    indices.insert(std::lower_bound(indices.begin(), indices.end(), index), index);
+    this->names[index] = &iter->first;
+  }
+
+  private: void unsetName(Int index)
+  {
+    Str const *name = this->names[index];
+    if (name == 0) return;
+    this->names[index] = 0;
+    auto iter = this->indicesByName.find(*name);
+    ASSERT(iter != this->indicesByName.end());
+    auto &indices = iter->second;
+    indices.erase(std::lower_bound(indices.begin(), indices.end(), index));
+    if (indices.empty()) this->indicesByName.erase(iter);
+  }
+
+  /**
+   * @brief Add the given delta to the indices of all elements starting from
+   *        the given position.
+   * Elements are visited in the direction of the shift so that a shifted index
+   * never collides with an index that is yet to be shifted.
+   */
+  private: void shiftIndices(Int startIndex, Int delta)
+  {
+    Int count = this->names.size();
+    for (Int j = 0; j < count - startIndex; ++j) {
+      Int i = delta > 0 ? count - 1 - j : startIndex + j;
+      Str const *name = this->names[i];
+      if (name == 0) continue;
+      auto &indices = this->indicesByName[*name];
+      *std::lower_bound(indices.begin(), indices.end(), i) += delta;
+    }
+  }
+
+}; // class
+
+} // namespace
+
+#endif
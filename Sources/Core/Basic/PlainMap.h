@@ -37,6 +37,15 @@ template<class CTYPE> class PlainMap : public PlainMapBase<CTYPE, TiObject>
     this->add(args);
   }
 
+  public: PlainMap(MapIndexType indexType) : _MyBase(indexType)
+  {
+  }
+
+  public: PlainMap(std::initializer_list<Argument> const &args, MapIndexType indexType) : _MyBase(indexType)
+  {
+    this->add(args);
+  }
+
   public: virtual ~PlainMap()
   {
     this->destruct();
@@ -63,6 +63,11 @@ template<class CTYPE, class PTYPE> class PlainMapBase : public PTYPE, public Dyn
   {
   }
 
+  /// Create the map with the given type of index.
+  protected: PlainMapBase(MapIndexType indexType) : map(indexType), inherited(0), base(0)
+  {
+  }
+
   /// Delete the index created in the constructor, if any.
   public: virtual ~PlainMapBase() = 0;
 
@@ -37,6 +37,15 @@ template<class CTYPE> class SharedMap : public SharedMapBase<CTYPE, TiObject>
     this->add(args);
   }
 
+  public: SharedMap(MapIndexType indexType) : _MyBase(indexType)
+  {
+  }
+
+  public: SharedMap(std::initializer_list<Argument> const &args, MapIndexType indexType) : _MyBase(indexType)
+  {
+    this->add(args);
+  }
+
   public: virtual ~SharedMap()
   {
     this->destruct();
@@ -63,6 +63,11 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
   {
   }
 
+  /// Create the map with the given type of index.
+  protected: SharedMapBase(MapIndexType indexType) : map(indexType), inherited(0), base(0)
+  {
+  }
+
   /// Delete the index created in the constructor, if any.
   public: virtual ~SharedMapBase() = 0;
 
@@ -73,6 +73,12 @@ class SubsetIndex
     for (Int i = pos; i < this->indices.getLength(); ++i) --this->indices(i);
   }
 
+  public: Bool contains(Int index) const
+  {
+    Int pos = this->findPos(index);
+    return pos != -1 && this->indices(pos) == index;
+  }
+
   public: Word getSize() const
   {
     return this->indices.getLength();
@@ -88,8 +88,17 @@ class TiObject
   /// Get this type's info.
   public: static ObjectTypeInfo const* getTypeInfo();
 
-  /// Check if this object is of the given type, or a derived type.
-  public: Bool isDerivedFrom(TypeInfo const *info) const;
+  /**
+   * @brief Check if this object is of the given type, or a derived type.
+   *
+   * @return Returns true if the given type info is for the class from which
+   *         this object is instantiated, or for the class from which this
+   *         object's class is derived, false otherwise.
+   */
+  public: Bool isDerivedFrom(TypeInfo const *info) const
+  {
+    return this->getMyTypeInfo()->isDerivedFrom(info);
+  }
 
   /**
    * @brief A template equivalent to isDerivedFrom.
@@ -0,0 +1,221 @@
+/**
+ * @file Core/Basic/TimeReport.cpp
+ * Contains the implementation of class Core::Basic::TimeReport.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#include <iomanip>
+
+namespace Core::Basic
+{
+
+//==============================================================================
+// Member Functions
+
+TimeReport* TimeReport::getSingleton()
+{
+  static TimeReport *timeReport = 0;
+  if (timeReport == 0) {
+    timeReport = reinterpret_cast<TimeReport*>(GLOBAL_STORAGE->getObject(S("Core::Basic::TimeReport")));
+    if (timeReport == 0) {
+      timeReport = new TimeReport;
+      GLOBAL_STORAGE->setObject(S("Core::Basic::TimeReport"), reinterpret_cast<void*>(timeReport));
+    }
+  }
+  return timeReport;
+}
+
+
+void TimeReport::setEnabled(Bool e)
+{
+  if (e) {
+    this->clear();
+    this->startTime = std::chrono::steady_clock::now();
+    this->mainThreadId = std::this_thread::get_id();
+  }
+  this->enabled = e;
+}
+
+
+void TimeReport::clear()
+{
+  for (Word i = 0; i < PHASE_COUNT; ++i) {
+    this->phaseTimes[i] = 0;
+    this->phaseCalls[i] = 0;
+    this->threadPhaseTimes[i] = 0;
+    this->threadPhaseCalls[i] = 0;
+  }
+  for (Word i = 0; i < COUNTER_COUNT; ++i) this->counters[i] = 0;
+}
+
+
+Bool TimeReport::beginPhase(Phase phase)
+{
+  auto &stack = TimeReport::getPhaseStack();
+  if (!stack.empty() && stack.back().phase == phase.val) return false;
+
+  auto now = std::chrono::steady_clock::now();
+  if (!stack.empty()) {
+    // Pause the outer phase.
+    this->addPhaseTime(stack.back().phase, now - stack.back().startTime);
+  }
+  stack.push_back({ phase.val, now });
+  if (std::this_thread::get_id() == this->mainThreadId) ++this->phaseCalls[phase.val];
+  else ++this->threadPhaseCalls[phase.val];
+  return true;
+}
+
+
+void TimeReport::endPhase() noexcept
+{
+  auto &stack = TimeReport::getPhaseStack();
+  if (stack.empty()) return;
+
+  auto now = std::chrono::steady_clock::now();
+  this->addPhaseTime(stack.back().phase, now - stack.back().startTime);
+  stack.pop_back();
+  // Resume the outer phase.
+  if (!stack.empty()) stack.back().startTime = now;
+}
+
+
+void TimeReport::addPhaseTime(Int phase, std::chrono::steady_clock::duration time)
+{
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+  if (std::this_thread::get_id() == this->mainThreadId) this->phaseTimes[phase] += ns;
+  else this->threadPhaseTimes[phase] += ns;
+}
+
+
+std::vector<TimeReport::PhaseFrame>& TimeReport::getPhaseStack()
+{
+  static thread_local std::vector<PhaseFrame> stack;
+  return stack;
+}
+
+
+Char const* TimeReport::getPhaseName(Phase phase)
+{
+  switch (phase.val) {
+    case Phase::LEXING: return S("lexing");
+    case Phase::PARSING: return S("parsing");
+    case Phase::AST_PROCESSING: return S("astProcessing");
+    case Phase::PREPROCESSING: return S("preprocessing");
+    case Phase::CODE_GENERATION: return S("codeGeneration");
+    case Phase::OPTIMIZATION: return S("optimization");
+    case Phase::CODE_EMISSION: return S("codeEmission");
+    case Phase::EXECUTION: return S("execution");
+  }
+  return S("");
+}
+
+
+Char const* TimeReport::getCounterName(Counter counter)
+{
+  switch (counter.val) {
+    case Counter::TOKENS: return S("tokens");
+    case Counter::AST_NODES: return S("astNodes");
+    case Counter::FUNCTIONS: return S("functions");
+    case Counter::TEMPLATE_INSTANCES: return S("templateInstances");
+    case Counter::CALLEE_CACHE_HITS: return S("calleeCacheHits");
+    case Counter::CALLEE_CACHE_MISSES: return S("calleeCacheMisses");
+    case Counter::SHARED_FUNCTIONS: return S("sharedFunctions");
+    case Counter::JIT_CACHE_HITS: return S("jitCacheHits");
+  }
+  return S("");
+}
+
+
+void TimeReport::print(OutStream &stream) const
+{
+  auto wallTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - this->startTime
+  ).count();
+  LongWord totalTime = 0;
+  for (Word i = 0; i < PHASE_COUNT; ++i) totalTime += this->phaseTimes[i];
+
+  auto flags = stream.flags();
+  auto precision = stream.precision();
+  stream << std::fixed << std::setprecision(3);
+
+  stream << NEW_LINE << S("-- TIME REPORT --") << NEW_LINE << NEW_LINE;
+  stream << std::left << std::setw(20) << S("Phase") << std::right << std::setw(14) << S("Time (ms)")
+    << std::setw(12) << S("Calls") << std::setw(10) << S("Share") << NEW_LINE;
+  for (Word i = 0; i < PHASE_COUNT; ++i) {
+    Double share = totalTime == 0 ? 0 : this->phaseTimes[i] * 100.0 / totalTime;
+    stream << std::left << std::setw(20) << TimeReport::getPhaseName(static_cast<Phase::_Phase>(i))
+      << std::right << std::setw(14) << this->phaseTimes[i] / 1000000.0
+      << std::setw(12) << this->phaseCalls[i]
+      << std::setw(9) << std::setprecision(1) << share << S("%") << std::setprecision(3) << NEW_LINE;
+  }
+  stream << std::left << std::setw(20) << S("total") << std::right << std::setw(14) << totalTime / 1000000.0
+    << NEW_LINE;
+  stream << std::left << std::setw(20) << S("wall") << std::right << std::setw(14) << wallTime / 1000000.0
+    << NEW_LINE << NEW_LINE;
+
+  // Times of other threads overlap the main thread's, so they get their own table.
+  LongWord threadTotalTime = 0;
+  for (Word i = 0; i < PHASE_COUNT; ++i) threadTotalTime += this->threadPhaseTimes[i];
+  if (threadTotalTime > 0) {
+    stream << std::left << std::setw(20) << S("Other Threads") << std::right << std::setw(14) << S("Time (ms)")
+      << std::setw(12) << S("Calls") << NEW_LINE;
+    for (Word i = 0; i < PHASE_COUNT; ++i) {
+      if (this->threadPhaseCalls[i] == 0) continue;
+      stream << std::left << std::setw(20) << TimeReport::getPhaseName(static_cast<Phase::_Phase>(i))
+        << std::right << std::setw(14) << this->threadPhaseTimes[i] / 1000000.0
+        << std::setw(12) << this->threadPhaseCalls[i] << NEW_LINE;
+    }
+    stream << std::left << std::setw(20) << S("total") << std::right << std::setw(14)
+      << threadTotalTime / 1000000.0 << NEW_LINE << NEW_LINE;
+  }
+
+  stream << std::left << std::setw(20) << S("Counter") << std::right << std::setw(14) << S("Count") << NEW_LINE;
+  for (Word i = 0; i < COUNTER_COUNT; ++i) {
+    stream << std::left << std::setw(20) << TimeReport::getCounterName(static_cast<Counter::_Counter>(i))
+      << std::right << std::setw(14) << this->counters[i] << NEW_LINE;
+  }
+
+  stream.flags(flags);
+  stream.precision(precision);
+}
+
+
+Bool TimeReport::writeJson(Char const *filename) const
+{
+  std::ofstream fout(filename);
+  if (fout.fail()) return false;
+
+  auto wallTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - this->startTime
+  ).count();
+
+  fout << std::fixed << std::setprecision(3);
+  fout << S("{\n  \"wallMs\": ") << wallTime / 1000000.0 << S(",\n  \"phases\": {\n");
+  for (Word i = 0; i < PHASE_COUNT; ++i) {
+    fout << S("    \"") << TimeReport::getPhaseName(static_cast<Phase::_Phase>(i)) << S("\": { \"ms\": ")
+      << this->phaseTimes[i] / 1000000.0 << S(", \"calls\": ") << this->phaseCalls[i] << S(" }")
+      << (i < PHASE_COUNT - 1 ? S(",\n") : S("\n"));
+  }
+  fout << S("  },\n  \"threadPhases\": {\n");
+  for (Word i = 0; i < PHASE_COUNT; ++i) {
+    fout << S("    \"") << TimeReport::getPhaseName(static_cast<Phase::_Phase>(i)) << S("\": { \"ms\": ")
+      << this->threadPhaseTimes[i] / 1000000.0 << S(", \"calls\": ") << this->threadPhaseCalls[i] << S(" }")
+      << (i < PHASE_COUNT - 1 ? S(",\n") : S("\n"));
+  }
+  fout << S("  },\n  \"counters\": {\n");
+  for (Word i = 0; i < COUNTER_COUNT; ++i) {
+    fout << S("    \"") << TimeReport::getCounterName(static_cast<Counter::_Counter>(i)) << S("\": ")
+      << this->counters[i] << (i < COUNTER_COUNT - 1 ? S(",\n") : S("\n"));
+  }
+  fout << S("  }\n}\n");
+  return !fout.fail();
+}
+
+} // namespace
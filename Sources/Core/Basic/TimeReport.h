@@ -0,0 +1,212 @@
+/**
+ * @file Core/Basic/TimeReport.h
+ * Contains the header of class Core::Basic::TimeReport.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_BASIC_TIMEREPORT_H
+#define CORE_BASIC_TIMEREPORT_H
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace Core::Basic
+{
+
+/**
+ * @brief Collects the time spent in each phase of the build process.
+ * @ingroup basic_utils
+ *
+ * This is a singleton shared by all modules. Phases are timed using the
+ * TIME_PHASE macro, which does nothing unless the report is enabled. Phases
+ * nest freely and the time is exclusive, i.e. when a phase starts while
+ * another is running on the same thread the time of the outer phase is paused
+ * until the inner phase is done, so the times of all phases add up to the
+ * total time. Re-entering the phase that is already running is ignored, which
+ * allows recursive functions to be timed. Only times of the thread that
+ * enabled the report add up to the total time. Times of other threads (like
+ * JIT compile threads) run concurrently with it, so they are summed separately
+ * and reported on their own.
+ *
+ * The report also keeps a set of counters for the items processed during the
+ * build, like tokens and generated functions.
+ */
+class TimeReport
+{
+  //============================================================================
+  // Types
+
+  public: s_enum(Phase,
+    LEXING,
+    PARSING,
+    AST_PROCESSING,
+    PREPROCESSING,
+    CODE_GENERATION,
+    OPTIMIZATION,
+    CODE_EMISSION,
+    EXECUTION
+  );
+
+  public: s_enum(Counter,
+    TOKENS,
+    AST_NODES,
+    FUNCTIONS,
+    TEMPLATE_INSTANCES,
+    CALLEE_CACHE_HITS,
+    CALLEE_CACHE_MISSES,
+    SHARED_FUNCTIONS,
+    JIT_CACHE_HITS
+  );
+
+  /// A phase running on a thread.
+  private: struct PhaseFrame
+  {
+    Int phase;
+    std::chrono::steady_clock::time_point startTime;
+  };
+
+  /// Times a phase for as long as the object is alive.
+  public: class Scope
+  {
+    private: TimeReport *report;
+    private: Bool active;
+
+    public: Scope(Phase phase) : report(TimeReport::getSingleton())
+    {
+      this->active = this->report->isEnabled() && this->report->beginPhase(phase);
+    }
+
+    public: ~Scope() noexcept
+    {
+      if (this->active) this->report->endPhase();
+    }
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: static constexpr Word PHASE_COUNT = Phase::EXECUTION + 1;
+  private: static constexpr Word COUNTER_COUNT = Counter::JIT_CACHE_HITS + 1;
+
+  private: Bool enabled = false;
+  private: std::chrono::steady_clock::time_point startTime;
+  private: std::thread::id mainThreadId;
+  /// Times and calls of the thread that enabled the report.
+  private: std::atomic<LongWord> phaseTimes[PHASE_COUNT];
+  private: std::atomic<LongWord> phaseCalls[PHASE_COUNT];
+  /// Times and calls of all other threads.
+  private: std::atomic<LongWord> threadPhaseTimes[PHASE_COUNT];
+  private: std::atomic<LongWord> threadPhaseCalls[PHASE_COUNT];
+  private: std::atomic<LongWord> counters[COUNTER_COUNT];
+
+
+  //============================================================================
+  // Constructor / Destructor
+
+  protected: TimeReport()
+  {
+    this->clear();
+  }
+
+  public: virtual ~TimeReport()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: static TimeReport* getSingleton();
+
+  /**
+   * @brief Enable or disable collecting times.
+   * Enabling the report clears it and makes the calling thread the main
+   * thread of the report.
+   */
+  public: void setEnabled(Bool e);
+
+  public: Bool isEnabled() const
+  {
+    return this->enabled;
+  }
+
+  /// Reset all times and counters.
+  public: void clear();
+
+  /**
+   * @brief Start timing the given phase on the current thread.
+   * This is virtual to make sure the stack of running phases, which is thread
+   * local, is the same regardless of the module making the call.
+   * @return Returns false if the given phase is already the innermost running
+   *         phase, in which case endPhase shouldn't be called.
+   */
+  public: virtual Bool beginPhase(Phase phase);
+
+  /**
+   * @brief Stop timing the last phase started on the current thread.
+   * This is called from destructors, so it doesn't throw. Calling it while no
+   * phase is running does nothing.
+   */
+  public: virtual void endPhase() noexcept;
+
+  /// Increment the given counter, if the report is enabled.
+  public: void addCount(Counter counter, LongWord count = 1)
+  {
+    if (this->enabled) this->counters[counter.val] += count;
+  }
+
+  /// Get the value of the given counter.
+  public: LongWord getCount(Counter counter) const
+  {
+    return this->counters[counter.val];
+  }
+
+  /// Get the stack of phases running on the current thread.
+  private: static std::vector<PhaseFrame>& getPhaseStack();
+
+  /// Add the given time to the phase times of the current thread.
+  private: void addPhaseTime(Int phase, std::chrono::steady_clock::duration time);
+
+  /// Get the name of the given phase as used in the report.
+  public: static Char const* getPhaseName(Phase phase);
+
+  /// Get the name of the given counter as used in the report.
+  public: static Char const* getCounterName(Counter counter);
+
+  /// Print the report as a table to the given stream.
+  public: void print(OutStream &stream) const;
+
+  /**
+   * @brief Write the report in JSON format to the given file.
+   * @return Returns false if the file couldn't be written.
+   */
+  public: Bool writeJson(Char const *filename) const;
+
+}; // class
+
+} // namespace
+
+
+/**
+ * @brief Time the given phase until the end of the current scope.
+ * @ingroup basic_utils
+ */
+#define TIME_PHASE(phase) \
+  Core::Basic::TimeReport::Scope __timeReportScope(Core::Basic::TimeReport::Phase::phase)
+
+/**
+ * @brief Increment the given time report counter.
+ * @ingroup basic_utils
+ */
+#define TIME_REPORT_COUNT(counter, count) \
+  Core::Basic::TimeReport::getSingleton()->addCount(Core::Basic::TimeReport::Counter::counter, count)
+
+#endif
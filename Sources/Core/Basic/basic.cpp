@@ -169,4 +169,14 @@ void printIndents(OutStream &stream, int indents)
   }
 }
 
+
+Bool isEnvFlagEnabled(Char const *name, Bool defaultValue)
+{
+  Char const *value = getenv(name);
+  if (value == 0) return defaultValue;
+  if (compareStr(value, S("0")) == 0 || compareStr(value, S("off")) == 0) return false;
+  if (compareStr(value, S("1")) == 0 || compareStr(value, S("on")) == 0) return true;
+  return defaultValue;
+}
+
 } } // namespace
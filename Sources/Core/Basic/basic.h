@@ -580,6 +580,24 @@ Int parseHexDigits(WChar const *wc, Word count);
 /// Print 'indents' number of spaces.
 void printIndents(OutStream &stream, int indents);
 
+/**
+ * @brief Check whether a feature is enabled by an environment variable.
+ * @ingroup basic_functions
+ *
+ * Setting the variable to 0 or off disables the feature and setting it to 1 or
+ * on enables it. Otherwise the given default is returned. The following
+ * variables are read this way, and their features are enabled by default
+ * unless noted otherwise:<br>
+ * ALUSUS_JIT_CACHE: Cache JIT compiled objects on disk. Defaults to the
+ * command line setting.<br>
+ * ALUSUS_GRAMMAR_SNAPSHOT: Save and load snapshots of the compiled grammar.<br>
+ * ALUSUS_CALLEE_CACHE: Cache the results of callee lookups.<br>
+ * ALUSUS_TEMPLATE_INDEX: Index template instances by their arguments.<br>
+ * ALUSUS_IMPORT_PREFETCH: Read imported files ahead on other threads.<br>
+ * ALUSUS_SHARED_CODE: Link JIT code to functions compiled for preprocessing.
+ */
+Bool isEnvFlagEnabled(Char const *name, Bool defaultValue);
+
 /**
  * @brief Generate an Str from the given format and args.
  * @ingroup basic_functions
@@ -671,6 +689,7 @@ extern std::istream &inStream;
 #include "validators.h"
 
 #include "SubsetIndex.h"
+#include "NameIndex.h"
 
 #include "GlobalStorage.h"
 
@@ -688,6 +707,7 @@ extern std::istream &inStream;
 #include "ti_object_factories.h"
 
 #include "Finally.h"
+#include "TimeReport.h"
 #include "signals.h"
 
 #include "Argument.h"
@@ -70,6 +70,18 @@ class TypeInfo
   /// Pointer to the type info of the base type.
   private: TypeInfo const* baseTypeInfo;
 
+  /**
+   * @brief The type infos of this type's ancestors indexed by their depth.
+   *
+   * The array starts with the root of the hierarchy and ends with this type
+   * itself, which allows isDerivedFrom to check for derivation in constant
+   * time instead of walking the chain of base types.
+   */
+  private: TypeInfo const **ancestors;
+
+  /// The depth of this type in its hierarchy, 0 for types without a base.
+  private: Word depth;
+
 
   //============================================================================
   // Constructor
@@ -96,6 +108,17 @@ class TypeInfo
     baseTypeInfo(baseTypeInfo)
   {
     this->uniqueName = this->url + "/" + this->packageName + "/" + this->typeNamespace + "." + this->typeName;
+    this->depth = baseTypeInfo == 0 ? 0 : baseTypeInfo->depth + 1;
+    this->ancestors = new TypeInfo const*[this->depth + 1];
+    for (Word i = 0; i < this->depth; ++i) this->ancestors[i] = baseTypeInfo->ancestors[i];
+    this->ancestors[this->depth] = this;
+  }
+
+  public: TypeInfo(TypeInfo const&) = delete;
+
+  public: ~TypeInfo()
+  {
+    delete[] this->ancestors;
   }
 
 
@@ -158,6 +181,25 @@ class TypeInfo
     return this->baseTypeInfo;
   }
 
+  /// Get the depth of this type in its hierarchy, 0 for types without a base.
+  public: Word getDepth() const
+  {
+    return this->depth;
+  }
+
+  /**
+   * @brief Check if this type is the given type or is derived from it.
+   *
+   * The given type can only be an ancestor of this type if it's at the same
+   * depth as this type or above it, in which case it has to be the ancestor
+   * at that depth. A null type is never an ancestor.
+   */
+  public: Bool isDerivedFrom(TypeInfo const *info) const
+  {
+    if (info == 0) return false;
+    return info->depth <= this->depth && this->ancestors[info->depth] == info;
+  }
+
 }; // class
 
 
@@ -15,6 +15,18 @@
 namespace Core::Data::Ast
 {
 
+//==============================================================================
+// Member Functions
+
+void Definition::setName(Char const *n)
+{
+  this->name = n;
+  // Keep the definitions index of the owning scope in sync.
+  auto scope = ti_cast<Scope>(this->getOwner());
+  if (scope != 0) scope->onDefinitionRenamed(this);
+}
+
+
 //==============================================================================
 // Printable Implementation
 
@@ -74,13 +74,10 @@ class Definition : public Node,
   //============================================================================
   // Member Functions
 
-  public: void setName(Char const *n)
-  {
-    this->name = n;
-  }
+  public: void setName(Char const *n);
   public: void setName(TiStr const *n)
   {
-    this->name = n == 0 ? "" : n->get();
+    this->setName(n == 0 ? S("") : n->get());
   }
 
   public: TiStr const& getName() const
@@ -91,6 +88,8 @@ class Definition : public Node,
   public: void setTarget(TioSharedPtr const &t)
   {
     UPDATE_OWNED_SHAREDPTR(this->target, t);
+    // Definitions that aren't in the tree yet can't have been found by any lookup.
+    if (this->getOwner() != 0) incrementDefinitionsGeneration();
   }
   private: void setTarget(TiObject *t)
   {
@@ -0,0 +1,90 @@
+/**
+ * @file Core/Data/Ast/MetaExtras.h
+ * Contains the header of class Core::Data::Ast::MetaExtras.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_AST_METAEXTRAS_H
+#define CORE_DATA_AST_METAEXTRAS_H
+
+namespace Core::Data::Ast
+{
+
+/**
+ * @brief Storage of extra data attached to MetaHaving objects.
+ * @ingroup core_data_ast
+ *
+ * Extras are keyed by slot ids registered through MetaHaving::getExtraSlot.
+ * Objects usually carry only a handful of extras, if any, so they are kept in
+ * a flat list that is searched linearly, which is both smaller and faster than
+ * a map for such small counts. An object without extras only pays for an empty
+ * vector.
+ */
+class MetaExtras
+{
+  //============================================================================
+  // Types
+
+  private: struct Entry
+  {
+    Word slot;
+    TioSharedPtr obj;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: std::vector<Entry> entries;
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void set(Word slot, TioSharedPtr const &obj)
+  {
+    for (auto &entry : this->entries) {
+      if (entry.slot == slot) {
+        entry.obj = obj;
+        return;
+      }
+    }
+    this->entries.push_back({ slot, obj });
+  }
+
+  public: void remove(Word slot)
+  {
+    for (Word i = 0; i < this->entries.size(); ++i) {
+      if (this->entries[i].slot == slot) {
+        // Order is irrelevant, so fill the gap with the last entry.
+        if (i + 1 < this->entries.size()) this->entries[i] = std::move(this->entries.back());
+        this->entries.pop_back();
+        return;
+      }
+    }
+  }
+
+  public: TioSharedPtr const& get(Word slot) const
+  {
+    for (auto const &entry : this->entries) {
+      if (entry.slot == slot) return entry.obj;
+    }
+    return TioSharedPtr::null;
+  }
+
+  public: Word getCount() const
+  {
+    return this->entries.size();
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -20,18 +20,32 @@ namespace Core::Data::Ast
 
 void Scope::onAdded(Int index)
 {
-  this->bridgesIndex.onAdded(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  auto def = ti_cast<Definition>(this->getElement(index));
+  auto isBridge = ti_cast<Bridge>(this->getElement(index)) != 0;
+  this->definitionsIndex.onAdded(index, def == 0 ? 0 : &def->getName().getStr());
+  this->bridgesIndex.onAdded(index, isBridge);
+  if (def != 0 || isBridge) incrementDefinitionsGeneration();
   List::onAdded(index);
 }
 
 void Scope::onUpdated(Int index)
 {
-  this->bridgesIndex.onUpdated(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  auto def = ti_cast<Definition>(this->getElement(index));
+  auto isBridge = ti_cast<Bridge>(this->getElement(index)) != 0;
+  if (def != 0 || isBridge || this->definitionsIndex.hasName(index) || this->bridgesIndex.contains(index)) {
+    incrementDefinitionsGeneration();
+  }
+  this->definitionsIndex.onUpdated(index, def == 0 ? 0 : &def->getName().getStr());
+  this->bridgesIndex.onUpdated(index, isBridge);
   List::onUpdated(index);
 }
 
 void Scope::onRemoved(Int index)
 {
+  if (this->definitionsIndex.hasName(index) || this->bridgesIndex.contains(index)) {
+    incrementDefinitionsGeneration();
+  }
+  this->definitionsIndex.onRemoved(index);
   this->bridgesIndex.onRemoved(index);
   List::onRemoved(index);
 }
@@ -48,4 +62,18 @@ Bridge* Scope::getBridge(Int index) const
   return static_cast<Bridge*>(this->getElement(this->bridgesIndex.get(index)));
 }
 
+
+//==============================================================================
+// Definition Retrieval Functions
+
+void Scope::onDefinitionRenamed(Definition *def)
+{
+  incrementDefinitionsGeneration();
+  for (Int i = 0; i < this->getCount(); ++i) {
+    if (this->getElement(i) == def) {
+      this->definitionsIndex.onUpdated(i, &def->getName().getStr());
+    }
+  }
+}
+
 } // namespace
@@ -29,6 +29,7 @@ class Scope : public List
   // Memver Variables
 
   private: SubsetIndex bridgesIndex;
+  private: NameIndex definitionsIndex;
 
 
   //============================================================================
@@ -73,6 +74,20 @@ class Scope : public List
 
   /// @}
 
+  /// @name Definition Retrieval Functions
+  /// @{
+
+  /// Get the sorted indices of the definitions with the given name, or null if none.
+  public: std::vector<Int> const* findDefinitionIndices(Str const &name) const
+  {
+    return this->definitionsIndex.find(name);
+  }
+
+  /// Update the index of definitions after the given definition is renamed.
+  public: void onDefinitionRenamed(Definition *def);
+
+  /// @}
+
 }; // class
 
 } // namespace
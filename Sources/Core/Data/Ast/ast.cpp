@@ -11,6 +11,7 @@
 //==============================================================================
 
 #include "core.h"
+#include <mutex>
 
 namespace Core::Data::Ast
 {
@@ -26,6 +27,37 @@ SharedPtr<SourceLocation> const& findSourceLocation(TiObject const *obj)
 }
 
 
+/**
+ * The counter is kept in the global storage since Core is linked statically
+ * into the executable as well as the libraries, and all of them need to see
+ * the same counter.
+ */
+static Word* getDefinitionsGenerationCounter()
+{
+  static Word *counter = 0;
+  if (counter == 0) {
+    counter = reinterpret_cast<Word*>(GLOBAL_STORAGE->getObject(S("Core::Data::Ast::definitionsGeneration")));
+    if (counter == 0) {
+      counter = new Word(0);
+      GLOBAL_STORAGE->setObject(S("Core::Data::Ast::definitionsGeneration"), reinterpret_cast<void*>(counter));
+    }
+  }
+  return counter;
+}
+
+
+Word getDefinitionsGeneration()
+{
+  return *getDefinitionsGenerationCounter();
+}
+
+
+void incrementDefinitionsGeneration()
+{
+  ++*getDefinitionsGenerationCounter();
+}
+
+
 void addSourceLocation(TiObject *obj, SourceLocation *sl)
 {
   if (sl == 0) return;
@@ -295,4 +327,96 @@ Bool isEqual(TiObject *obj1, TiObject *obj2)
   return true;
 }
 
+
+/**
+ * Visits the same members and elements compared by isEqual. Objects that
+ * isEqual only compares by type, like source locations, are hashed by their
+ * type only.
+ */
+Word computeHash(TiObject *obj)
+{
+  if (obj == 0) return 0;
+
+  Word hash = std::hash<void const*>()(obj->getMyTypeInfo());
+  auto combine = [&hash](Word value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+  auto hashStr = [](Char const *str)->Word {
+    return str == 0 ? 0 : std::hash<std::string_view>()(str);
+  };
+
+  // Hash basic types.
+
+  if (obj->isDerivedFrom<TiInt>()) {
+    combine(std::hash<Int>()(static_cast<TiInt*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiWord>()) {
+    combine(std::hash<Word>()(static_cast<TiWord*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiFloat>()) {
+    combine(std::hash<Float>()(static_cast<TiFloat*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiBool>()) {
+    combine(static_cast<TiBool*>(obj)->get() ? 1 : 0);
+    return hash;
+  } else if (obj->isDerivedFrom<TiStr>()) {
+    combine(hashStr(static_cast<TiStr*>(obj)->get()));
+    return hash;
+  } else if (obj->isDerivedFrom<TiWStr>()) {
+    auto str = static_cast<TiWStr*>(obj)->get();
+    combine(str == 0 ? 0 : std::hash<std::wstring_view>()(str));
+    return hash;
+  }
+
+  // Hash class properties.
+
+  auto bindings = ti_cast<Binding>(obj);
+  if (bindings != 0) {
+    for (Int i = 0; i < bindings->getMemberCount(); ++i) combine(computeHash(bindings->getMember(i)));
+  }
+
+  auto mapContainer = ti_cast<MapContaining<TiObject>>(obj);
+  if (mapContainer != 0) {
+    for (Int i = 0; i < mapContainer->getElementCount(); ++i) combine(hashStr(mapContainer->getElementKey(i)));
+  }
+
+  auto container = ti_cast<Containing<TiObject>>(obj);
+  if (container != 0) {
+    combine(container->getElementCount());
+    for (Int i = 0; i < container->getElementCount(); ++i) combine(computeHash(container->getElement(i)));
+  }
+
+  return hash;
+}
+
+
+//============================================================================
+// MetaHaving Static Functions
+
+/**
+ * Slots are registered in a registry kept in the global storage so that all
+ * modules linking Core agree on the slot of each name.
+ */
+Word MetaHaving::getExtraSlot(Char const *name)
+{
+  struct SlotRegistry
+  {
+    std::mutex mutex;
+    std::unordered_map<std::string, Word> slots;
+  };
+  // The registry is looked up in a static initializer so that threads making their first call at the same time wait
+  // for a single registry rather than each creating its own.
+  static SlotRegistry *registry = []() {
+    auto registry = reinterpret_cast<SlotRegistry*>(GLOBAL_STORAGE->getObject(S("Core::Data::Ast::MetaHaving::extraSlots")));
+    if (registry == 0) {
+      registry = new SlotRegistry;
+      GLOBAL_STORAGE->setObject(S("Core::Data::Ast::MetaHaving::extraSlots"), reinterpret_cast<void*>(registry));
+    }
+    return registry;
+  }();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  auto result = registry->slots.emplace(name, registry->slots.size());
+  return result.first->second;
+}
+
 } // namespace
@@ -81,6 +81,17 @@ class Definition;
 
 SharedPtr<SourceLocation> const& findSourceLocation(TiObject const *obj);
 
+/**
+ * @brief Get a counter that changes whenever definitions change in any scope.
+ * The counter is incremented whenever definitions or bridges are added to,
+ * updated in, or removed from a scope, and whenever a definition that is part
+ * of the tree is renamed or retargeted. Other statements don't affect it.
+ * It can be used to invalidate caches of symbol lookup results.
+ */
+Word getDefinitionsGeneration();
+
+void incrementDefinitionsGeneration();
+
 void addSourceLocation(TiObject *obj, SourceLocation *sl);
 
 Bool mergeDefinition(
@@ -109,8 +120,16 @@ template <class T> SharedPtr<T> clone(T *obj, SourceLocation *sl = 0)
 
 Bool isEqual(TiObject *obj1, TiObject *obj2);
 
+/**
+ * @brief Compute a structural hash of the given tree.
+ * The hash is consistent with isEqual, i.e. equal trees always have the same
+ * hash, so it can be used to detect whether a tree changed.
+ */
+Word computeHash(TiObject *obj);
+
 } // namespace
 
+#include "MetaExtras.h"
 #include "MetaHaving.h"
 #include "Mergeable.h"
 
@@ -32,7 +32,14 @@ class DataStack : public TiObject, public DynamicContaining<TiObject>
   //============================================================================
   // Member Variables
 
-  private: SharedList<TiObject> stack;
+  /**
+   * @brief The levels owned by this stack.
+   * A plain vector is used rather than a SharedList since this stack is
+   * pushed, popped, and cleared on every route test the parser makes and
+   * doesn't need change notifications. Clearing the vector keeps its buffer,
+   * so a stack that is reused across branches doesn't allocate again.
+   */
+  private: std::vector<SharedPtr<TiObject>> stack;
 
   private: DataStack *trunkStack;
   private: Int trunkIndex;
@@ -63,7 +70,7 @@ class DataStack : public TiObject, public DynamicContaining<TiObject>
 
   public: void push(SharedPtr<TiObject> const &obj)
   {
-    this->stack.add(obj);
+    this->stack.push_back(obj);
   }
 
   public: void pop();
@@ -74,7 +81,7 @@ class DataStack : public TiObject, public DynamicContaining<TiObject>
 
   public: Word getCount() const
   {
-    return this->trunkIndex + 1 + this->stack.getCount();
+    return this->trunkIndex + 1 + this->stack.size();
   }
 
   /**
@@ -131,7 +138,8 @@ class DataStack : public TiObject, public DynamicContaining<TiObject>
 
   public: virtual Int addElement(TiObject *val)
   {
-    return this->stack.addElement(val);
+    this->stack.push_back(getSharedPtr(val));
+    return this->trunkIndex + this->stack.size();
   }
 
   public: virtual void insertElement(Int index, TiObject *val);
@@ -0,0 +1,225 @@
+/**
+ * @file Core/Data/Grammar/LexerDfa.h
+ * Contains the header of class Core::Data::Grammar::LexerDfa.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_GRAMMAR_LEXERDFA_H
+#define CORE_DATA_GRAMMAR_LEXERDFA_H
+
+#include <algorithm>
+
+namespace Core::Data::Grammar
+{
+
+/**
+ * @brief The compiled, table driven form of a lexer module.
+ * @ingroup core_data_grammar
+ *
+ * This class holds a DFA that is equivalent to the token definitions
+ * of a LexerModule. Input characters are first mapped into character classes
+ * (ranges of characters that are treated identically by all definitions) and
+ * then the class is used to index a dense transitions table. Each state also
+ * records the index of the token definition that would be selected if the
+ * token ends at that state, or -1 if no token ends there.
+ *
+ * State 0 is always the dead state (no token can be matched anymore) and state
+ * 1 is always the start state. The object is created by the lexer and cached
+ * in the LexerModule until the grammar caches are cleared.
+ *
+ * The DFA is normally built incrementally. Transitions that weren't computed
+ * yet are set to UNKNOWN_TRANSITION and accepted tokens that weren't computed
+ * yet are set to UNKNOWN_ACCEPTANCE. The lexer computes them the first time
+ * the input needs them, using the build data it attached to the DFA, so only
+ * the parts of the grammar used by the scanned source are ever compiled. A
+ * fully compiled and minimized DFA has no unknown entries and no build data;
+ * that form is what gets saved in a GrammarSnapshot.
+ */
+class LexerDfa
+{
+  //============================================================================
+  // Constants
+
+  public: static constexpr Int DEAD_STATE = 0;
+  public: static constexpr Int START_STATE = 1;
+  public: static constexpr Int DIRECT_CLASS_TABLE_SIZE = 128;
+  public: static constexpr Int UNKNOWN_TRANSITION = -1;
+  public: static constexpr Int UNKNOWN_ACCEPTANCE = -2;
+
+
+  //============================================================================
+  // Types
+
+  /// Base class of the data the lexer needs to compute the unknown entries.
+  public: class BuildData
+  {
+    public: virtual ~BuildData()
+    {
+    }
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// Whether the grammar was compiled successfully.
+  private: Bool valid = false;
+
+  /**
+   * @brief The first character of each character class, sorted ascendingly.
+   * The first class always starts at the lowest possible WChar value.
+   */
+  private: std::vector<WChar> classStarts;
+
+  /// Direct lookup of the character classes of the lower characters.
+  private: Int directClasses[DIRECT_CLASS_TABLE_SIZE];
+
+  /// The transitions table, indexed by state * class count + class.
+  private: std::vector<Int> transitions;
+
+  /// The index of the token definition accepted at each state, or -1.
+  private: std::vector<Int> acceptedDefIndexes;
+
+  /// The number of transitions and accepted tokens that are not computed yet.
+  private: Word unknownCount = 0;
+
+  /// The data used to compute the unknown entries, dropped once none are left.
+  private: SharedPtr<BuildData> buildData;
+
+
+  //============================================================================
+  // Constructor / Destructor
+
+  /// Creates an invalid DFA, used to mark grammars that couldn't be compiled.
+  public: LexerDfa()
+  {
+  }
+
+  public: LexerDfa(
+    std::vector<WChar> classStarts, std::vector<Int> transitions, std::vector<Int> acceptedDefIndexes
+  ) : valid(true), classStarts(std::move(classStarts)), transitions(std::move(transitions)),
+      acceptedDefIndexes(std::move(acceptedDefIndexes))
+  {
+    for (Int i = 0; i < DIRECT_CLASS_TABLE_SIZE; ++i) this->directClasses[i] = this->findClass(i);
+  }
+
+  /**
+   * @brief Creates an incremental DFA.
+   * The DFA starts with the dead state and a start state whose transitions are
+   * all unknown. The start state never accepts a token.
+   */
+  public: LexerDfa(std::vector<WChar> classStarts, SharedPtr<BuildData> const &buildData)
+    : valid(true), classStarts(std::move(classStarts)), buildData(buildData)
+  {
+    for (Int i = 0; i < DIRECT_CLASS_TABLE_SIZE; ++i) this->directClasses[i] = this->findClass(i);
+    this->transitions.resize(this->classStarts.size(), DEAD_STATE);
+    this->acceptedDefIndexes.push_back(-1);
+    this->addState();
+    this->setAcceptedDefIndex(START_STATE, -1);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: Bool isValid() const
+  {
+    return this->valid;
+  }
+
+  public: Int getClassCount() const
+  {
+    return this->classStarts.size();
+  }
+
+  public: Int getStateCount() const
+  {
+    return this->acceptedDefIndexes.size();
+  }
+
+  /// Get the character class of the given character.
+  public: Int getClass(WChar ch) const
+  {
+    if (ch >= 0 && ch < DIRECT_CLASS_TABLE_SIZE) return this->directClasses[ch];
+    else return this->findClass(ch);
+  }
+
+  /// Get the state reached from the given state by the given character class, or UNKNOWN_TRANSITION.
+  public: Int getNextState(Int state, Int charClass) const
+  {
+    return this->transitions[state * this->classStarts.size() + charClass];
+  }
+
+  /// Get the index of the token definition accepted at the given state, -1, or UNKNOWN_ACCEPTANCE.
+  public: Int getAcceptedDefIndex(Int state) const
+  {
+    return this->acceptedDefIndexes[state];
+  }
+
+  /// Check whether all the transitions and accepted tokens are computed.
+  public: Bool isComplete() const
+  {
+    return this->unknownCount == 0;
+  }
+
+  public: BuildData* getBuildData() const
+  {
+    return this->buildData.get();
+  }
+
+  /// Add a new state whose transitions and accepted token are unknown.
+  public: Int addState()
+  {
+    Int state = this->acceptedDefIndexes.size();
+    this->transitions.resize(this->transitions.size() + this->classStarts.size(), UNKNOWN_TRANSITION);
+    this->acceptedDefIndexes.push_back(UNKNOWN_ACCEPTANCE);
+    this->unknownCount += this->classStarts.size() + 1;
+    return state;
+  }
+
+  /// Set an unknown transition. The build data is released once nothing is unknown.
+  public: void setNextState(Int state, Int charClass, Int nextState)
+  {
+    this->transitions[state * this->classStarts.size() + charClass] = nextState;
+    if (--this->unknownCount == 0) this->buildData.reset();
+  }
+
+  /// Set an unknown accepted token. The build data is released once nothing is unknown.
+  public: void setAcceptedDefIndex(Int state, Int acceptedDefIndex)
+  {
+    this->acceptedDefIndexes[state] = acceptedDefIndex;
+    if (--this->unknownCount == 0) this->buildData.reset();
+  }
+
+  public: std::vector<WChar> const& getClassStarts() const
+  {
+    return this->classStarts;
+  }
+
+  public: std::vector<Int> const& getTransitions() const
+  {
+    return this->transitions;
+  }
+
+  public: std::vector<Int> const& getAcceptedDefIndexes() const
+  {
+    return this->acceptedDefIndexes;
+  }
+
+  private: Int findClass(WChar ch) const
+  {
+    auto iter = std::upper_bound(this->classStarts.begin(), this->classStarts.end(), ch);
+    return static_cast<Int>(iter - this->classStarts.begin()) - 1;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -40,6 +40,9 @@ class LexerModule : public Module, public CacheHaving
 
   private: CharBasedDecisionCache charBasedDecisionCache;
 
+  /// The compiled form of this module's token definitions, if already compiled.
+  private: SharedPtr<LexerDfa> dfa;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -75,6 +78,16 @@ class LexerModule : public Module, public CacheHaving
     return &this->charBasedDecisionCache;
   }
 
+  public: void setDfa(SharedPtr<LexerDfa> const &d)
+  {
+    this->dfa = d;
+  }
+
+  public: SharedPtr<LexerDfa> const& getDfa() const
+  {
+    return this->dfa;
+  }
+
 
   //============================================================================
   // CacheHaving Implementation
@@ -83,6 +96,7 @@ class LexerModule : public Module, public CacheHaving
   public: virtual void clearCache()
   {
     this->charBasedDecisionCache.clear();
+    this->dfa.reset();
   }
 
 }; // class
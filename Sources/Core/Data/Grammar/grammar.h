@@ -181,6 +181,7 @@ template <class T> SharedPtr<T> cloneInherited(T *obj)
 #include "List.h"
 #include "Map.h"
 #include "Module.h"
+#include "LexerDfa.h"
 #include "LexerModule.h"
 
 // Character Groups
@@ -35,7 +35,7 @@ class IdGenerator
   // Member Variables
 
   private: Srl::Array<Str> ids;
-  private: Srl::ArrayIndex<Str> index;
+  private: Srl::ArrayHashIndex<Str> index;
 
 
   //============================================================================
@@ -642,26 +642,32 @@ Seeker::Verb Seeker::_foreach_identifierOnScope(
   TiObject *self, Data::Ast::Identifier *identifier, Data::Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        verb = cb(Action::ALIAS_TRACE_START, obj);
-        if (verb == Verb::SKIP) return Verb::MOVE;
-        else if (!Seeker::isMove(verb)) return verb;
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
-        );
-        if (!Seeker::isMove(verb)) break;
-        verb = cb(Action::ALIAS_TRACE_END, obj);
-        if (verb != Verb::MOVE) return verb;
-      } else {
-        verb = cb(Action::TARGET_MATCH, obj);
-        if (!Seeker::isMove(verb)) break;
-      }
+  // The callback might modify the scope, so we look up the next matching index on each iteration rather than
+  // holding on to the indices vector.
+  Int i = -1;
+  while (true) {
+    auto indices = scope->findDefinitionIndices(identifier->getValue().getStr());
+    if (indices == 0) break;
+    auto iter = std::upper_bound(indices->begin(), indices->end(), i);
+    if (iter == indices->end()) break;
+    i = *iter;
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      verb = cb(Action::ALIAS_TRACE_START, obj);
+      if (verb == Verb::SKIP) return Verb::MOVE;
+      else if (!Seeker::isMove(verb)) return verb;
+      PREPARE_SELF(seeker, Seeker);
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~Flags::SKIP_OWNED
+      );
+      if (!Seeker::isMove(verb)) break;
+      verb = cb(Action::ALIAS_TRACE_END, obj);
+      if (verb != Verb::MOVE) return verb;
+    } else {
+      verb = cb(Action::TARGET_MATCH, obj);
+      if (!Seeker::isMove(verb)) break;
     }
   }
   return verb;
@@ -11,10 +11,41 @@
 //==============================================================================
 
 #include "core.h"
+#include <mutex>
 
 namespace Core { namespace Data
 {
 
+//==============================================================================
+// SourceLocationRecord Functions
+
+/**
+ * The table is kept in the global storage since Core is linked statically
+ * into the executable as well as the libraries, and records created by any of
+ * them need to refer to the same interned names.
+ */
+Str const* SourceLocationRecord::internFilename(Char const *fname)
+{
+  struct FilenameTable
+  {
+    std::mutex mutex;
+    std::unordered_set<Str> filenames;
+  };
+  static Char const *tableName = S("Core::Data::SourceLocationRecord::filenames");
+  // Creating the table in a static initializer makes racing first callers share one table.
+  static FilenameTable *table = []() {
+    auto table = reinterpret_cast<FilenameTable*>(GLOBAL_STORAGE->getObject(tableName));
+    if (table == 0) {
+      table = new FilenameTable;
+      GLOBAL_STORAGE->setObject(tableName, reinterpret_cast<void*>(table));
+    }
+    return table;
+  }();
+  std::lock_guard<std::mutex> lock(table->mutex);
+  return &*table->filenames.emplace(fname).first;
+}
+
+
 //==============================================================================
 // SourceLocationStack Functions
 
@@ -33,6 +33,12 @@ class SourceLocation : public TiObject
  * This class holds the location data within the source code of a token or
  * a parsed data object. This includes, the name of the source file, and the
  * line and column within that file at which the token appeared.
+ *
+ * A record is created for every token and for most parsed objects, so the
+ * filename isn't stored in each record. Instead, filenames are interned in a
+ * global table and records only refer to the interned name, which keeps
+ * records small and cheap to copy and allows filenames to be compared by
+ * identity.
  */
 class SourceLocationRecord : public SourceLocation
 {
@@ -45,7 +51,8 @@ class SourceLocationRecord : public SourceLocation
   //============================================================================
   // Members
 
-  public: Str filename;
+  /// The interned name of the source file.
+  private: Str const *filename;
 
   /**
    * @brief The line number within the source file.
@@ -63,11 +70,12 @@ class SourceLocationRecord : public SourceLocation
   //============================================================================
   // Constructors and Operators
 
-  public: SourceLocationRecord()
+  public: SourceLocationRecord() : filename(SourceLocationRecord::getEmptyFilename())
   {
   }
 
-  public: SourceLocationRecord(Str const &fname, Int l, Int c) : filename(fname), line(l), column(c)
+  public: SourceLocationRecord(Char const *fname, Int l, Int c)
+    : filename(SourceLocationRecord::internFilename(fname)), line(l), column(c)
   {
   }
 
@@ -76,6 +84,33 @@ class SourceLocationRecord : public SourceLocation
     return this->filename == sl.filename && this->line == sl.line && this->column == sl.column;
   }
 
+
+  //============================================================================
+  // Member Functions
+
+  public: void setFilename(Char const *fname)
+  {
+    this->filename = SourceLocationRecord::internFilename(fname);
+  }
+
+  public: Str const& getFilename() const
+  {
+    return *this->filename;
+  }
+
+  /**
+   * @brief Get the interned copy of the given filename.
+   * The same pointer is returned for all equal filenames, and the returned
+   * name remains valid for the lifetime of the process.
+   */
+  public: static Str const* internFilename(Char const *fname);
+
+  private: static Str const* getEmptyFilename()
+  {
+    static Str const *emptyFilename = SourceLocationRecord::internFilename(S(""));
+    return emptyFilename;
+  }
+
 }; // class
 
 
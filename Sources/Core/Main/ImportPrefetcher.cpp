@@ -0,0 +1,158 @@
+/**
+ * @file Core/Main/ImportPrefetcher.cpp
+ * Contains the implementation of class Core::Main::ImportPrefetcher.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Main
+{
+
+/// The maximum number of threads used to read imported files.
+#define IMPORT_PREFETCH_MAX_THREADS 4
+
+//==============================================================================
+// Constructors & Destructor
+
+ImportPrefetcher::~ImportPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stopping = true;
+  }
+  this->condition.notify_all();
+  for (auto &worker : this->workers) worker.join();
+}
+
+
+//==============================================================================
+// Member Functions
+
+Bool ImportPrefetcher::isEnabled()
+{
+  static Bool enabled = isEnvFlagEnabled(S("ALUSUS_IMPORT_PREFETCH"), true);
+  return enabled;
+}
+
+
+void ImportPrefetcher::prefetch(Char const *fullPath)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!this->entries.emplace(fullPath, Entry()).second) return;
+    this->queue.push_back(fullPath);
+    static Word maxWorkerCount = std::min<Word>(
+      std::max(std::thread::hardware_concurrency(), 1u), IMPORT_PREFETCH_MAX_THREADS
+    );
+    if (this->workers.size() < maxWorkerCount) this->workers.emplace_back(&ImportPrefetcher::work, this);
+  }
+  this->condition.notify_all();
+}
+
+
+Bool ImportPrefetcher::take(Char const *fullPath, std::string &content)
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  auto it = this->entries.find(fullPath);
+  if (it == this->entries.end()) return false;
+  auto &entry = it->second;
+  if (!entry.started && !entry.ready) {
+    // No worker picked the file up yet, so it's quicker for the caller to read it directly.
+    auto queueIt = std::find(this->queue.begin(), this->queue.end(), it->first);
+    if (queueIt != this->queue.end()) this->queue.erase(queueIt);
+    this->entries.erase(it);
+    return false;
+  }
+  this->condition.wait(lock, [&entry] { return entry.ready; });
+  Bool succeeded = entry.succeeded;
+  if (succeeded) content = std::move(entry.content);
+  this->entries.erase(fullPath);
+  return succeeded;
+}
+
+
+void ImportPrefetcher::clear()
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->queue.clear();
+  this->entries.clear();
+}
+
+
+Bool ImportPrefetcher::readFile(Char const *fullPath, std::string &content)
+{
+  // Text mode translates CRLF line endings on Windows, which processFile relies on as well.
+  std::ifstream fin(fullPath);
+  if (fin.fail()) return false;
+  content.assign(std::istreambuf_iterator<Char>(fin), std::istreambuf_iterator<Char>());
+  return !fin.bad();
+}
+
+
+void ImportPrefetcher::scanImports(Char const *content, Word size, std::vector<Str> &filenames)
+{
+  static Char const *keywords[] = { S("import"), S("اشمل") };
+  auto isIdentifierChar = [](Char c)->Bool {
+    return (c >= C('a') && c <= C('z')) || (c >= C('A') && c <= C('Z')) || (c >= C('0') && c <= C('9')) ||
+      c == C('_') || static_cast<unsigned char>(c) >= 0x80;
+  };
+  auto isSpace = [](Char c)->Bool {
+    return c == C(' ') || c == C('\t') || c == C('\r') || c == C('\n');
+  };
+
+  for (Word i = 0; i < size; ++i) {
+    if (i > 0 && isIdentifierChar(content[i - 1])) continue;
+    for (auto keyword : keywords) {
+      Word keywordLength = getStrLen(keyword);
+      if (i + keywordLength >= size || compareStr(content + i, keyword, keywordLength) != 0) continue;
+      // The keyword must be followed by white space and then a string literal.
+      Word j = i + keywordLength;
+      if (!isSpace(content[j])) continue;
+      while (j < size && isSpace(content[j])) ++j;
+      if (j >= size || content[j] != C('"')) continue;
+      Word start = ++j;
+      while (j < size && content[j] != C('"') && content[j] != C('\\') && content[j] != C('\n')) ++j;
+      if (j < size && content[j] == C('"') && j > start) filenames.push_back(Str(content + start, 0, j - start));
+      i = j;
+      break;
+    }
+  }
+}
+
+
+void ImportPrefetcher::work()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true) {
+    this->condition.wait(lock, [this] { return this->stopping || !this->queue.empty(); });
+    if (this->stopping) return;
+
+    std::string fullPath = std::move(this->queue.front());
+    this->queue.pop_front();
+    auto it = this->entries.find(fullPath);
+    if (it == this->entries.end()) continue;
+    it->second.started = true;
+
+    lock.unlock();
+    std::string content;
+    Bool succeeded = ImportPrefetcher::readFile(fullPath.c_str(), content);
+    lock.lock();
+
+    // The entry may have been dropped while the file was being read.
+    it = this->entries.find(fullPath);
+    if (it == this->entries.end()) continue;
+    it->second.content = std::move(content);
+    it->second.succeeded = succeeded;
+    it->second.ready = true;
+    this->condition.notify_all();
+  }
+}
+
+} // namespace
@@ -0,0 +1,110 @@
+/**
+ * @file Core/Main/ImportPrefetcher.h
+ * Contains the header of class Core::Main::ImportPrefetcher.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_MAIN_IMPORTPREFETCHER_H
+#define CORE_MAIN_IMPORTPREFETCHER_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace Core::Main
+{
+
+/**
+ * @brief Reads imported source files ahead of their parsing.
+ * @ingroup core_standard
+ *
+ * Parsing can't proceed concurrently since root statements, including imports,
+ * are executed as soon as they are parsed and can extend the grammar used to
+ * parse the statements that follow. Reading the files, on the other hand, is
+ * independent of parsing, so when a file is about to be parsed RootManager
+ * scans it for the files it imports and hands them to this class, which reads
+ * them on a pool of worker threads while the importing file is being parsed.
+ * The prefetched content is then parsed from memory in the original order.
+ *
+ * Prefetching can be disabled by setting the ALUSUS_IMPORT_PREFETCH
+ * environment variable to 0, in which case files are still read entirely into
+ * memory before parsing, but only when they are about to be parsed.
+ */
+class ImportPrefetcher
+{
+  //============================================================================
+  // Types
+
+  private: struct Entry
+  {
+    Bool started = false;
+    Bool ready = false;
+    Bool succeeded = false;
+    std::string content;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: std::mutex mutex;
+  private: std::condition_variable condition;
+  private: std::unordered_map<std::string, Entry> entries;
+  private: std::deque<std::string> queue;
+  private: std::vector<std::thread> workers;
+  private: Bool stopping = false;
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  public: ImportPrefetcher()
+  {
+  }
+
+  public: ~ImportPrefetcher();
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Check whether prefetching is enabled for this process.
+  public: static Bool isEnabled();
+
+  /// Queue the given file for reading, unless it's already queued.
+  public: void prefetch(Char const *fullPath);
+
+  /**
+   * @brief Take the prefetched content of the given file.
+   * Waits for the file to be read if a worker is already reading it.
+   * @return Returns true if the content was prefetched, false if the caller
+   *         needs to read the file itself.
+   */
+  public: Bool take(Char const *fullPath, std::string &content);
+
+  /// Drop all queued and unused prefetched files.
+  public: void clear();
+
+  /// Read the entire content of the given file.
+  public: static Bool readFile(Char const *fullPath, std::string &content);
+
+  /**
+   * @brief Find the filenames imported by the given source code.
+   * This is a quick textual scan rather than a parse, so it can find false
+   * positives (inside comments for example), which only cost an unneeded read.
+   */
+  public: static void scanImports(Char const *content, Word size, std::vector<Str> &filenames);
+
+  private: void work();
+
+}; // class
+
+} // namespace
+
+#endif
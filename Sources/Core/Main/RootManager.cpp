@@ -36,10 +36,14 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
   this->exprRootScope = Data::Ast::Scope::create();
   this->exprRootScope->setProdId(ID_GENERATOR->getId("Root"));
 
+  this->enginePool.initialize(this->rootScope);
+  this->exprEnginePool.initialize(this->exprRootScope);
+
   this->rootScopeHandler.setSeeker(&this->seeker);
   this->rootScopeHandler.setRootScope(this->rootScope);
 
   this->noticeSignal.relay(this->inerNoticeSignal);
+  this->noticeSignal.relay(this->enginePool.noticeSignal);
   this->noticeSignal.connect(this->noticeSlot);
 
   Data::Grammar::StandardFactory factory;
@@ -47,6 +51,8 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
   factory.createGrammar(this->exprRootScope.get(), this, true);
 
   this->interactive = false;
+  this->jitCacheEnabled = false;
+  this->jitThreadCount = -1;
   this->processArgCount = 0;
   this->processArgs = 0;
 
@@ -94,8 +100,9 @@ void RootManager::flushNotices()
 
 SharedPtr<TiObject> RootManager::parseExpression(Char const *str)
 {
-  Processing::Engine engine(this->exprRootScope);
-  auto result = engine.processString(str, str);
+  auto engine = this->exprEnginePool.acquire();
+  finally([=] { this->exprEnginePool.release(engine); });
+  auto result = engine->processString(str, str);
 
   if (result == 0) {
     throw EXCEPTION(
@@ -112,9 +119,9 @@ SharedPtr<TiObject> RootManager::parseExpression(Char const *str)
 
 SharedPtr<TiObject> RootManager::processString(Char const *str, Char const *name)
 {
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  return engine.processString(str, name);
+  auto engine = this->enginePool.acquire();
+  finally([=] { this->enginePool.release(engine); });
+  return engine->processString(str, name);
 }
 
 
@@ -147,9 +154,22 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
   }
 
   // Process the file.
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  auto result = engine.processFile(fullPath);
+  auto engine = this->enginePool.acquire();
+  finally([=] { this->enginePool.release(engine); });
+  SharedPtr<TiObject> result;
+  {
+    // Use the content if it was already prefetched, otherwise read it now.
+    std::string content;
+    if (!this->importPrefetcher.take(fullPath, content) && !ImportPrefetcher::readFile(fullPath, content)) {
+      throw EXCEPTION(InvalidArgumentException, S("fullPath"), S("Could not open file."), fullPath);
+    }
+    ++this->fileProcessingDepth;
+    finally([=] {
+      if (--this->fileProcessingDepth == 0) this->importPrefetcher.clear();
+    });
+    if (ImportPrefetcher::isEnabled()) this->prefetchImports(content);
+    result = engine->processBuffer(content.data(), content.size(), fullPath);
+  }
 
   // Remove the added path, if any.
   if (searchPath.getLength() > 0) {
@@ -162,9 +182,27 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
 
 SharedPtr<TiObject> RootManager::processStream(Processing::CharInStreaming *is, Char const *streamName)
 {
-  Processing::Engine engine(this->rootScope);
-  this->noticeSignal.relay(engine.noticeSignal);
-  return engine.processStream(is, streamName);
+  auto engine = this->enginePool.acquire();
+  finally([=] { this->enginePool.release(engine); });
+  return engine->processStream(is, streamName);
+}
+
+
+void RootManager::prefetchImports(std::string const &content)
+{
+  std::vector<Str> filenames;
+  ImportPrefetcher::scanImports(content.data(), content.size(), filenames);
+  std::array<Char,PATH_MAX> resultFilename;
+  for (auto const &filename : filenames) {
+    if (!this->findFile(filename, resultFilename)) continue;
+    if (this->processedFiles.findIndex(resultFilename.data()) != -1) continue;
+    for (Int i = 0; i < sizeof(sourceExtensions) / sizeof(sourceExtensions[0]); ++i) {
+      if (compareStrSuffix(resultFilename.data(), sourceExtensions[i])) {
+        this->importPrefetcher.prefetch(resultFilename.data());
+        break;
+      }
+    }
+  }
 }
 
 
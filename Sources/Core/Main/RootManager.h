@@ -45,7 +45,12 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
   private: RootScopeHandler rootScopeHandler;
   private: LibraryManager libraryManager;
 
+  private: Processing::EnginePool enginePool;
+  private: Processing::EnginePool exprEnginePool;
+
   private: SharedMap<TiObject> processedFiles;
+  private: ImportPrefetcher importPrefetcher;
+  private: Int fileProcessingDepth = 0;
 
   private: std::vector<Str> searchPaths;
   private: std::vector<Int> searchPathCounts;
@@ -57,6 +62,8 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
   private: Int minNoticeSeverityEncountered = -1;
 
   private: Bool interactive;
+  private: Bool jitCacheEnabled;
+  private: Int jitThreadCount;
   private: Int processArgCount;
   private: Char const *const *processArgs;
   private: Str language;
@@ -136,6 +143,8 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: virtual SharedPtr<TiObject> _processFile(Char const *fullPath, Bool allowReprocess = false);
 
+  private: void prefetchImports(std::string const &content);
+
   public: virtual SharedPtr<TiObject> processStream(Processing::CharInStreaming *is, Char const *streamName);
 
   public: virtual Bool tryImportFile(Char const *filename, Str &errorDetails);
@@ -170,6 +179,28 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->interactive;
   }
 
+  /// Enable or disable the on-disk cache of JIT compiled objects.
+  public: void setJitCacheEnabled(Bool e)
+  {
+    this->jitCacheEnabled = e;
+  }
+
+  public: Bool isJitCacheEnabled() const
+  {
+    return this->jitCacheEnabled;
+  }
+
+  /// Set the number of JIT compile threads, or -1 to use the default count.
+  public: void setJitThreadCount(Int c)
+  {
+    this->jitThreadCount = c;
+  }
+
+  public: Int getJitThreadCount() const
+  {
+    return this->jitThreadCount;
+  }
+
   public: void setProcessArgInfo(Int count, Char const *const *args)
   {
     this->processArgCount = count;
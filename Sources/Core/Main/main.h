@@ -96,6 +96,7 @@ Srl::String getModuleDirectory();
 #include "LibraryGateway.h"
 #include "LibraryManager.h"
 #include "RootScopeHandler.h"
+#include "ImportPrefetcher.h"
 #include "RootManager.h"
 
 #endif
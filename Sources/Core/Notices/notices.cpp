@@ -82,8 +82,8 @@ Str getSourceLocationString(Data::SourceLocation *sl, Int indentation) {
   if (sl->isDerivedFrom<Data::SourceLocationRecord>()) {
     auto slRecord = static_cast<Data::SourceLocationRecord*>(sl);
     auto filename = getSourceLocationPathSkipping() ?
-      strrchr(slRecord->filename.getBuf(), C('/')) + 1 :
-      slRecord->filename.getBuf();
+      strrchr(slRecord->getFilename().getBuf(), C('/')) + 1 :
+      slRecord->getFilename().getBuf();
     stream << filename << " (" << slRecord->line << "," << slRecord->column << ")";
   } else {
     auto stack = static_cast<Data::SourceLocationStack*>(sl);
@@ -31,6 +31,13 @@ void Engine::initialize(SharedPtr<Data::Ast::Scope> const &rootScope)
 }
 
 
+void Engine::reset()
+{
+  this->lexer.reset();
+  this->parser.reset();
+}
+
+
 SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
 {
   if (str == 0) {
@@ -42,7 +49,7 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
   // Start passing characters to the lexer.
 
   Data::SourceLocationRecord sourceLocation;
-  sourceLocation.filename = name;
+  sourceLocation.setFilename(name);
   sourceLocation.line = 1;
   sourceLocation.column = 1;
   lexer.handleNewString(str, sourceLocation);
@@ -61,14 +68,41 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
 
 SharedPtr<TiObject> Engine::processFile(Char const *filename)
 {
-  // Open the file.
+  // Read the entire file, in text mode so that line endings get translated where needed, and pass it to the lexer at
+  // once, the same way RootManager parses files.
   std::ifstream fin(filename);
-  StdCharInStream finStream(&fin);
-
   if (fin.fail()) {
     throw EXCEPTION(InvalidArgumentException, S("filename"), S("Could not open file."), filename);
   }
-  return this->processStream(&finStream, filename);
+  std::string content((std::istreambuf_iterator<Char>(fin)), std::istreambuf_iterator<Char>());
+  return this->processBuffer(content.data(), content.size(), filename);
+}
+
+
+SharedPtr<TiObject> Engine::processBuffer(Char const *buffer, Word size, Char const *name)
+{
+  if (buffer == 0 && size > 0) {
+    throw EXCEPTION(InvalidArgumentException, S("buffer"), S("Cannot be null."));
+  }
+
+  this->parser.beginParsing();
+
+  // Pass the entire buffer to the lexer.
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.setFilename(name);
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  if (size > 0) lexer.handleNewBuffer(buffer, size, sourceLocation);
+
+  auto endLine = sourceLocation.line;
+  auto endColumn = sourceLocation.column;
+
+  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+
+  sourceLocation.line = endLine;
+  sourceLocation.column = endColumn;
+
+  return this->parser.endParsing(sourceLocation);
 }
 
 
@@ -83,7 +117,7 @@ SharedPtr<TiObject> Engine::processStream(CharInStreaming *is, Char const *strea
 
   // Start passing characters to the lexer.
   Data::SourceLocationRecord sourceLocation;
-  sourceLocation.filename = streamName;
+  sourceLocation.setFilename(streamName);
   sourceLocation.line = 1;
   sourceLocation.column = 1;
   Char c = is->get();
@@ -63,12 +63,18 @@ class Engine : public TiObject
 
   public: void initialize(SharedPtr<Data::Ast::Scope> const &rootScope);
 
+  /// Clear the data of the previous parsing operation while keeping allocated buffers.
+  public: void reset();
+
   /// Parse the given string and return any resulting parsing data.
   public: SharedPtr<TiObject> processString(Char const *str, Char const *name);
 
   /// Parse the given file and return any resulting parsing data.
   public: SharedPtr<TiObject> processFile(Char const *filename);
 
+  /// Parse the given in-memory buffer and return any resulting parsing data.
+  public: SharedPtr<TiObject> processBuffer(Char const *buffer, Word size, Char const *name);
+
   /// Parse the given stream and return any resulting parsing data.
   public: SharedPtr<TiObject> processStream(CharInStreaming *is, Char const *streamName);
 
@@ -0,0 +1,60 @@
+/**
+ * @file Core/Processing/EnginePool.cpp
+ * Contains the implementation of class Core::Processing::EnginePool.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Member Functions
+
+void EnginePool::initialize(SharedPtr<Data::Ast::Scope> const &rootScope)
+{
+  if (rootScope == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("rootScope"), S("Cannot be null."));
+  }
+  this->idleEngines.clear();
+  this->rootScope = rootScope;
+}
+
+
+SharedPtr<Engine> EnginePool::acquire()
+{
+  if (this->rootScope == 0) {
+    throw EXCEPTION(GenericException, S("Engine pool is not initialized yet."));
+  }
+
+  if (this->idleEngines.empty()) {
+    auto engine = newSrdObj<Engine>(this->rootScope);
+    this->noticeSignal.relay(engine->noticeSignal);
+    return engine;
+  }
+
+  // The engine may have been released in the middle of parsing (due to an
+  // exception for example), so we'll always reset it.
+  auto engine = this->idleEngines.back();
+  this->idleEngines.pop_back();
+  engine->reset();
+  return engine;
+}
+
+
+void EnginePool::release(SharedPtr<Engine> const &engine)
+{
+  if (engine == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("engine"), S("Cannot be null."));
+  }
+  this->idleEngines.push_back(engine);
+}
+
+} // namespace
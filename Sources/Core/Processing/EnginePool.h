@@ -0,0 +1,76 @@
+/**
+ * @file Core/Processing/EnginePool.h
+ * Contains the header of class Core::Processing::EnginePool.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_ENGINEPOOL_H
+#define CORE_PROCESSING_ENGINEPOOL_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief A pool of parsing engines sharing the same root scope.
+ * @ingroup core_processing
+ *
+ * Initializing an engine allocates the lexer's state arrays and the parser's
+ * temp state, which adds up when strings are parsed frequently, as in
+ * interactive sessions or code generated during preprocessing. This pool keeps
+ * released engines and resets them on reuse instead of creating new ones.
+ * More than one engine can be in use at the same time since parsing a file can
+ * trigger the parsing of imported files.
+ */
+class EnginePool
+{
+  //============================================================================
+  // Member Variables
+
+  private: SharedPtr<Data::Ast::Scope> rootScope;
+
+  /// Engines that are currently not in use.
+  private: std::vector<SharedPtr<Engine>> idleEngines;
+
+
+  //============================================================================
+  // Signals
+
+  /// Emitted when a build msg (error or warning) is generated by any of the engines.
+  public: SignalRelay<void, SharedPtr<Notices::Notice> const&> noticeSignal;
+
+
+  //============================================================================
+  // Constructors / Destructor
+
+  public: EnginePool()
+  {
+  }
+
+  public: EnginePool(SharedPtr<Data::Ast::Scope> const &rootScope)
+  {
+    this->initialize(rootScope);
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void initialize(SharedPtr<Data::Ast::Scope> const &rootScope);
+
+  /// Get an engine that is ready for a new parsing operation.
+  public: SharedPtr<Engine> acquire();
+
+  /// Return an engine acquired from this pool.
+  public: void release(SharedPtr<Engine> const &engine);
+
+}; // class
+
+} // namespace
+
+#endif
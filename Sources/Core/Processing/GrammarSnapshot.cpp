@@ -0,0 +1,285 @@
+/**
+ * @file Core/Processing/GrammarSnapshot.cpp
+ * Contains the implementation of class Core::Processing::GrammarSnapshot.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "core.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <dlfcn.h>
+#ifdef WINDOWS
+  #include <process.h>
+  #define getpid _getpid
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace Core::Processing
+{
+
+static Char const SNAPSHOT_MAGIC[8] = { 'A', 'L', 'S', 'G', 'R', 'M', 'S', 'S' };
+
+
+static LongWord hashBytes(void const *bytes, Word size, LongWord hash)
+{
+  // FNV-1a.
+  for (Word i = 0; i < size; ++i) {
+    hash = (hash ^ static_cast<Byte const*>(bytes)[i]) * 1099511628211ul;
+  }
+  return hash;
+}
+
+
+//==============================================================================
+// Member Functions
+
+Bool GrammarSnapshot::isEnabled()
+{
+  static Bool enabled = [] {
+    return isEnvFlagEnabled(S("ALUSUS_GRAMMAR_SNAPSHOT"), true) && GrammarSnapshot::getDirectory().getLength() > 0;
+  }();
+  return enabled;
+}
+
+
+Str const& GrammarSnapshot::getDirectory()
+{
+  static Str dir = [] {
+    std::filesystem::path path;
+    Char const *customDir = getenv(S("ALUSUS_GRAMMAR_SNAPSHOT_DIR"));
+    Char const *cacheHome = getenv(S("XDG_CACHE_HOME"));
+    Char const *home = getenv(S("HOME"));
+    if (customDir != 0 && getStrLen(customDir) > 0) path = customDir;
+    else if (cacheHome != 0 && getStrLen(cacheHome) > 0) path = std::filesystem::path(cacheHome) / S("alusus/grammar");
+    else if (home != 0 && getStrLen(home) > 0) path = std::filesystem::path(home) / S(".cache/alusus/grammar");
+    else return Str();
+    std::error_code ec;
+    std::filesystem::create_directories(path, ec);
+    if (ec) return Str();
+    Str dir(path.string().c_str());
+    GrammarSnapshot::prune(dir);
+    return dir;
+  }();
+  return dir;
+}
+
+
+LongWord GrammarSnapshot::getVersionHash()
+{
+  static LongWord versionHash = [] {
+    Char const *version = ALUSUS_VERSION ALUSUS_REVISION;
+    LongWord hash = hashBytes(version, getStrLen(version), 14695981039346656037ul);
+
+    // Development builds share the same version, so we also include the size and modification time of the library
+    // containing this code to avoid using snapshots saved by a different build.
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(&GrammarSnapshot::getVersionHash), &info) != 0 && info.dli_fname != 0) {
+      std::error_code ec;
+      LongWord size = std::filesystem::file_size(info.dli_fname, ec);
+      if (!ec) hash = hashBytes(&size, sizeof(size), hash);
+      LongInt time = std::filesystem::last_write_time(info.dli_fname, ec).time_since_epoch().count();
+      if (!ec) hash = hashBytes(&time, sizeof(time), hash);
+    }
+    return hash;
+  }();
+  return versionHash;
+}
+
+
+SharedPtr<Data::Grammar::LexerDfa> GrammarSnapshot::loadLexerDfa(LongWord grammarHash, Word definitionCount)
+{
+  Str filename = GrammarSnapshot::getLexerDfaFilename(grammarHash);
+
+  // Map the file into memory, or read it on systems without mmap.
+  #ifndef WINDOWS
+    Int fd = open(filename.getBuf(), O_RDONLY);
+    if (fd == -1) return SharedPtr<Data::Grammar::LexerDfa>();
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+      close(fd);
+      return SharedPtr<Data::Grammar::LexerDfa>();
+    }
+    Word size = fileStat.st_size;
+    void *data = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return SharedPtr<Data::Grammar::LexerDfa>();
+    auto dfa = GrammarSnapshot::parseLexerDfa(static_cast<Char const*>(data), size, grammarHash, definitionCount);
+    munmap(data, size);
+  #else
+    std::ifstream file(filename.getBuf(), std::ios::binary);
+    if (!file) return SharedPtr<Data::Grammar::LexerDfa>();
+    std::vector<Char> buffer((std::istreambuf_iterator<Char>(file)), std::istreambuf_iterator<Char>());
+    auto dfa = GrammarSnapshot::parseLexerDfa(buffer.data(), buffer.size(), grammarHash, definitionCount);
+  #endif
+
+  if (dfa == 0) {
+    // Drop invalid snapshots so that they get replaced by valid ones.
+    std::error_code ec;
+    std::filesystem::remove(filename.getBuf(), ec);
+  } else {
+    // Mark the snapshot as recently used so that it's the last to be pruned.
+    std::error_code ec;
+    std::filesystem::last_write_time(filename.getBuf(), std::filesystem::file_time_type::clock::now(), ec);
+  }
+  return dfa;
+}
+
+
+void GrammarSnapshot::saveLexerDfa(LongWord grammarHash, Data::Grammar::LexerDfa const *dfa)
+{
+  VALIDATE_NOT_NULL(dfa);
+  if (!dfa->isValid()) return;
+
+  Header header;
+  GrammarSnapshot::prepareHeader(header, grammarHash);
+  header.classCount = dfa->getClassCount();
+  header.stateCount = dfa->getStateCount();
+
+  // Write into a temp file then rename it to avoid exposing partial files to other processes.
+  Str filename = GrammarSnapshot::getLexerDfaFilename(grammarHash);
+  Str tempFilename = filename + S(".") + std::to_string(getpid()).c_str();
+  {
+    std::ofstream file(tempFilename.getBuf(), std::ios::binary | std::ios::trunc);
+    if (!file) return;
+    file.write(reinterpret_cast<Char const*>(&header), sizeof(header));
+    file.write(
+      reinterpret_cast<Char const*>(dfa->getClassStarts().data()), dfa->getClassStarts().size() * sizeof(WChar)
+    );
+    file.write(
+      reinterpret_cast<Char const*>(dfa->getTransitions().data()), dfa->getTransitions().size() * sizeof(Int)
+    );
+    file.write(
+      reinterpret_cast<Char const*>(dfa->getAcceptedDefIndexes().data()),
+      dfa->getAcceptedDefIndexes().size() * sizeof(Int)
+    );
+    if (!file) {
+      file.close();
+      std::error_code ec;
+      std::filesystem::remove(tempFilename.getBuf(), ec);
+      return;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(tempFilename.getBuf(), filename.getBuf(), ec);
+  if (ec) std::filesystem::remove(tempFilename.getBuf(), ec);
+}
+
+
+SharedPtr<Data::Grammar::LexerDfa> GrammarSnapshot::parseLexerDfa(
+  Char const *data, Word size, LongWord grammarHash, Word definitionCount
+) {
+  // Validate the header.
+  if (size < sizeof(Header)) return SharedPtr<Data::Grammar::LexerDfa>();
+  Header expectedHeader;
+  GrammarSnapshot::prepareHeader(expectedHeader, grammarHash);
+  Header const *header = reinterpret_cast<Header const*>(data);
+  if (
+    memcmp(header->magic, expectedHeader.magic, sizeof(header->magic)) != 0 ||
+    header->formatVersion != expectedHeader.formatVersion ||
+    memcmp(header->alususVersion, expectedHeader.alususVersion, sizeof(header->alususVersion)) != 0 ||
+    header->grammarHash != grammarHash
+  ) {
+    return SharedPtr<Data::Grammar::LexerDfa>();
+  }
+  Word classCount = header->classCount;
+  Word stateCount = header->stateCount;
+  if (
+    classCount == 0 || stateCount <= Data::Grammar::LexerDfa::START_STATE ||
+    stateCount > LEXER_DFA_MAX_STATE_COUNT ||
+    size != sizeof(Header) + classCount * sizeof(WChar) + (classCount + 1) * stateCount * sizeof(Int)
+  ) {
+    return SharedPtr<Data::Grammar::LexerDfa>();
+  }
+
+  // Validate the tables. Snapshots hold fully compiled DFAs, so unknown entries are invalid as well.
+  WChar const *classStarts = reinterpret_cast<WChar const*>(data + sizeof(Header));
+  Int const *transitions = reinterpret_cast<Int const*>(classStarts + classCount);
+  Int const *acceptedDefIndexes = transitions + classCount * stateCount;
+  if (classStarts[0] != std::numeric_limits<WChar>::min()) return SharedPtr<Data::Grammar::LexerDfa>();
+  for (Word i = 1; i < classCount; ++i) {
+    if (classStarts[i] <= classStarts[i - 1]) return SharedPtr<Data::Grammar::LexerDfa>();
+  }
+  for (Word i = 0; i < classCount * stateCount; ++i) {
+    if (transitions[i] < 0 || static_cast<Word>(transitions[i]) >= stateCount) {
+      return SharedPtr<Data::Grammar::LexerDfa>();
+    }
+  }
+  for (Word i = 0; i < stateCount; ++i) {
+    if (acceptedDefIndexes[i] < -1 || acceptedDefIndexes[i] >= static_cast<Int>(definitionCount)) {
+      return SharedPtr<Data::Grammar::LexerDfa>();
+    }
+  }
+
+  // Copy the tables.
+  return newSrdObj<Data::Grammar::LexerDfa>(
+    std::vector<WChar>(classStarts, classStarts + classCount),
+    std::vector<Int>(transitions, transitions + classCount * stateCount),
+    std::vector<Int>(acceptedDefIndexes, acceptedDefIndexes + stateCount)
+  );
+}
+
+
+Str GrammarSnapshot::getLexerDfaFilename(LongWord grammarHash)
+{
+  Char name[64];
+  snprintf(name, sizeof(name), S("/lexer-%016llx.snapshot"), static_cast<unsigned long long>(grammarHash));
+  return GrammarSnapshot::getDirectory() + name;
+}
+
+
+void GrammarSnapshot::prune(Str const &dir)
+{
+  Char const *maxSize = getenv(S("ALUSUS_GRAMMAR_SNAPSHOT_SIZE"));
+  LongInt maxSizeMb = maxSize == 0 ? 0 : atol(maxSize);
+  if (maxSizeMb <= 0) maxSizeMb = GRAMMAR_SNAPSHOT_DEFAULT_MAX_SIZE;
+  LongWord maxSizeBytes = maxSizeMb * 1024 * 1024;
+
+  // Collect the snapshots along with their sizes and last use times.
+  struct Entry
+  {
+    std::filesystem::path path;
+    std::filesystem::file_time_type time;
+    LongWord size;
+  };
+  std::vector<Entry> entries;
+  LongWord totalSize = 0;
+  std::error_code ec;
+  for (auto const &item : std::filesystem::directory_iterator(dir.getBuf(), ec)) {
+    if (!item.is_regular_file(ec) || item.path().extension() != S(".snapshot")) continue;
+    Entry entry{ item.path(), item.last_write_time(ec), item.file_size(ec) };
+    if (ec) continue;
+    totalSize += entry.size;
+    entries.push_back(std::move(entry));
+  }
+  if (totalSize <= maxSizeBytes) return;
+
+  // Remove the least recently used snapshots first.
+  std::sort(entries.begin(), entries.end(), [](Entry const &a, Entry const &b) { return a.time < b.time; });
+  for (auto const &entry : entries) {
+    if (totalSize <= maxSizeBytes) break;
+    if (std::filesystem::remove(entry.path, ec)) totalSize -= entry.size;
+  }
+}
+
+
+void GrammarSnapshot::prepareHeader(Header &header, LongWord grammarHash)
+{
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+  header.formatVersion = GrammarSnapshot::FORMAT_VERSION;
+  strncpy(header.alususVersion, ALUSUS_VERSION ALUSUS_REVISION, sizeof(header.alususVersion) - 1);
+  header.grammarHash = grammarHash;
+}
+
+} // namespace
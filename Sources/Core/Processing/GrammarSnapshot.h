@@ -0,0 +1,115 @@
+/**
+ * @file Core/Processing/GrammarSnapshot.h
+ * Contains the header of class Core::Processing::GrammarSnapshot.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_GRAMMARSNAPSHOT_H
+#define CORE_PROCESSING_GRAMMARSNAPSHOT_H
+
+/// The default maximum size, in megabytes, of the grammar snapshots directory.
+#define GRAMMAR_SNAPSHOT_DEFAULT_MAX_SIZE 64
+
+namespace Core::Processing
+{
+
+/**
+ * @brief Stores the compiled forms of grammars on disk.
+ * @ingroup core_processing
+ *
+ * Compiling the lexer grammar into a DFA is the most expensive step of
+ * preparing a grammar for use, and the result is the same on every run as long
+ * as the grammar doesn't change. This class saves the compiled DFA into a
+ * snapshot file after it's compiled and maps that file into memory on later
+ * runs instead of compiling the grammar again.
+ *
+ * Snapshot files are keyed by a hash of the grammar's definitions computed by
+ * the lexer, so any change to the grammar, including custom grammar added at
+ * run time, results in a different snapshot. The Alusus version is stored in
+ * the snapshot and included in the hash, so snapshots are never shared across
+ * versions. The hash also covers the size and modification time of the Core
+ * library, so development builds sharing the same version don't share
+ * snapshots either. Loaded snapshots are validated and ignored if any of their
+ * values is out of range. The snapshots directory is pruned to a maximum size
+ * once per process, removing the least recently used snapshots first.
+ *
+ * Snapshots can be configured using the following environment variables:
+ *   ALUSUS_GRAMMAR_SNAPSHOT: Set to 0 to disable snapshots.
+ *   ALUSUS_GRAMMAR_SNAPSHOT_DIR: The snapshots directory. Defaults to
+ *                                alusus/grammar within the user's cache
+ *                                directory.
+ *   ALUSUS_GRAMMAR_SNAPSHOT_SIZE: The maximum size of the snapshots directory
+ *                                 in megabytes.
+ */
+class GrammarSnapshot
+{
+  //============================================================================
+  // Constants
+
+  /// The version of the file format. Must be increased whenever the format changes.
+  public: static constexpr Word FORMAT_VERSION = 1;
+
+
+  //============================================================================
+  // Types
+
+  private: struct Header
+  {
+    Char magic[8];
+    Word formatVersion;
+    Char alususVersion[32];
+    LongWord grammarHash;
+    Word classCount;
+    Word stateCount;
+  };
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Check whether snapshots are enabled and a snapshots directory is available.
+  public: static Bool isEnabled();
+
+  /// Get the directory in which snapshots are stored, or an empty string if none is available.
+  public: static Str const& getDirectory();
+
+  /// Get a hash of the running Alusus build, to be combined with grammar hashes.
+  public: static LongWord getVersionHash();
+
+  /**
+   * @brief Load the lexer DFA of the grammar with the given hash.
+   * @param definitionCount The number of elements in the lexer module, which
+   *                        accepted token definition indexes must be below.
+   * @return Returns the loaded DFA, or null if there is no valid snapshot for
+   *         the given grammar.
+   */
+  public: static SharedPtr<Data::Grammar::LexerDfa> loadLexerDfa(LongWord grammarHash, Word definitionCount);
+
+  /**
+   * @brief Save the given lexer DFA as a snapshot of the grammar with the given hash.
+   * Failures are silently ignored since snapshots are merely an optimization.
+   */
+  public: static void saveLexerDfa(LongWord grammarHash, Data::Grammar::LexerDfa const *dfa);
+
+  private: static SharedPtr<Data::Grammar::LexerDfa> parseLexerDfa(
+    Char const *data, Word size, LongWord grammarHash, Word definitionCount
+  );
+
+  /// Remove the least recently used snapshots until the directory is within its size limit.
+  private: static void prune(Str const &dir);
+
+  private: static Str getLexerDfaFilename(LongWord grammarHash);
+
+  private: static void prepareHeader(Header &header, LongWord grammarHash);
+
+}; // class
+
+} // namespace
+
+#endif
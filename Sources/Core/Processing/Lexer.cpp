@@ -11,6 +11,7 @@
 //==============================================================================
 
 #include "core.h"
+#include <limits>
 
 namespace Core::Processing
 {
@@ -38,17 +39,63 @@ void Lexer::initialize(SharedPtr<Data::Ast::Scope> rootScope)
   }
 
   // Prepare the context.
+  this->prepareGrammarContext();
+
+  // TODO: If we have a new grammar, we need to set the production_in_use_inquirer signal.
+  //if (this->production_definitions != 0) {
+  //    this->production_definitions->production_in_use_inquirer.connect(this, &Parser::is_production_in_use);
+  //}
+}
+
+
+/**
+ * Clears all the data of the previous parsing operation while keeping the
+ * allocated states and buffers for the next operation. Unlike initialize(),
+ * the grammar root is kept, but the lexer module is looked up again since the
+ * grammar may have been modified by the previous operation.
+ */
+void Lexer::reset()
+{
+  if (this->states == 0) {
+    throw EXCEPTION(GenericException, S("Lexer is not initialized yet."));
+  }
+
+  // Recycle all states instead of deleting them.
+  for (Int i = 0; i < this->stateCount; ++i) {
+    this->recycledStates[this->recycledStateCount++] = this->states[i];
+  }
+  this->stateCount = 0;
+  for (Int i = 0; i < this->nextStateCount; ++i) {
+    this->recycledStates[this->recycledStateCount++] = this->nextStates[i];
+  }
+  this->nextStateCount = 0;
+
+  this->inputBuffer.clear();
+  this->errorBuffer.clear();
+
+  this->dfa.reset();
+  this->dfaState = Data::Grammar::LexerDfa::DEAD_STATE;
+  this->dfaTokenDefIndex = -1;
+  this->dfaTokenLength = 0;
+
+  this->tempByteCharCount = 0;
+  this->currentProcessingIndex = 0;
+  this->currentTokenClamped = false;
+  this->lastToken.setId(UNKNOWN_ID);
+
+  this->prepareGrammarContext();
+}
+
+
+void Lexer::prepareGrammarContext()
+{
   this->grammarContext.setRoot(this->grammarRoot.get());
+  this->grammarContext.setModule(0);
   Data::Grammar::LexerModule *lexerModule = this->grammarContext.getAssociatedLexerModule();
   if (lexerModule == 0) {
     throw EXCEPTION(GenericException, S("Couldn't find a lexer module in the given grammar repository."));
   }
   this->grammarContext.setModule(lexerModule);
-
-  // TODO: If we have a new grammar, we need to set the production_in_use_inquirer signal.
-  //if (this->production_definitions != 0) {
-  //    this->production_definitions->production_in_use_inquirer.connect(this, &Parser::is_production_in_use);
-  //}
 }
 
 
@@ -63,6 +110,8 @@ void Lexer::initialize(SharedPtr<Data::Ast::Scope> rootScope)
  */
 void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLocation)
 {
+  TIME_PHASE(LEXING);
+
   // Buffer the input sequence until it can be converted to wide characters.
   this->tempByteCharBuffer[this->tempByteCharCount] = inputChar;
   ++this->tempByteCharCount;
@@ -93,8 +142,56 @@ void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLoca
  */
 void Lexer::handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation)
 {
-  for (Int i = 0; i < static_cast<Int>(strlen(inputStr)); i++) {
-    this->handleNewChar(inputStr[i], sourceLocation);
+  this->handleNewBuffer(inputStr, getStrLen(inputStr), sourceLocation);
+}
+
+
+/**
+ * Add a buffer of characters to the input buffer and keep processing until no
+ * more characters are in the input buffer. Complete UTF-8 sequences are decoded
+ * directly from the given buffer, while incomplete or invalid sequences go
+ * through handleNewChar so that sequences split between buffers and invalid
+ * input are handled exactly like character by character input.
+ *
+ * @param buffer The characters to add to the input buffer.
+ * @param size The number of characters in the buffer.
+ * @param sourceLocation The source location of the first character in the
+ *                       buffer. This will be updated with the new location.
+ */
+void Lexer::handleNewBuffer(Char const *buffer, Word size, Data::SourceLocationRecord &sourceLocation)
+{
+  TIME_PHASE(LEXING);
+
+  Word i = 0;
+  while (i < size) {
+    // Determine the length of the sequence from its leading byte.
+    Word byte = static_cast<unsigned char>(buffer[i]);
+    Word sequenceLength = 0;
+    if (this->tempByteCharCount == 0) {
+      if (byte < 0x80) sequenceLength = 1;
+      else if (byte >= 0xC2 && byte <= 0xDF) sequenceLength = 2;
+      else if (byte >= 0xE0 && byte <= 0xEF) sequenceLength = 3;
+      else if (byte >= 0xF0 && byte <= 0xF4) sequenceLength = 4;
+      if (i + sequenceLength > size) sequenceLength = 0;
+    }
+
+    // Decode the sequence.
+    WChar ch = byte;
+    if (sequenceLength > 1) {
+      Int processedIn, processedOut;
+      convertStr(buffer + i, sequenceLength, &ch, 1, processedIn, processedOut);
+      if (processedOut != 1 || processedIn != static_cast<Int>(sequenceLength)) sequenceLength = 0;
+    }
+    if (sequenceLength == 0) {
+      this->handleNewChar(buffer[i], sourceLocation);
+      ++i;
+      continue;
+    }
+
+    this->pushChar(ch, sourceLocation);
+    this->processBuffer();
+    computeNextCharPosition(ch, sourceLocation.line, sourceLocation.column);
+    i += sequenceLength;
   }
 }
 
@@ -111,6 +208,7 @@ void Lexer::processBuffer()
       LOG(LogLevel::LEXER_MAJOR, S("Emitting token. ID: ")
           << ID_GENERATOR->getDesc(this->getLastToken()->getId())
           << S(", Text: ") << this->getLastToken()->getText());
+      TIME_REPORT_COUNT(TOKENS, 1);
       this->tokenGenerated.emit(this->getLastToken());
     }
     if (r & 2) break;
@@ -143,8 +241,12 @@ Bool Lexer::pushChar(WChar ch, Data::SourceLocationRecord const &sl)
     if (this->currentProcessingIndex >= this->inputBuffer.getCharCount()) {
       // Check if there are any closed state.
       Int closedStateCount = 0;
-      for (Word i = 0; i < this->stateCount; i++) {
-        if (this->states[i]->getTokenLength() != 0) closedStateCount++;
+      if (this->dfa != 0) {
+        if (this->dfaTokenLength != 0) closedStateCount++;
+      } else {
+        for (Word i = 0; i < this->stateCount; i++) {
+          if (this->states[i]->getTokenLength() != 0) closedStateCount++;
+        }
       }
       if (closedStateCount == 0) {
         // There are no closed states, so replace the last character.
@@ -214,6 +316,10 @@ Int Lexer::process()
   // If there isn't, inform the caller to add new characters.
   if (this->currentProcessingIndex >= this->inputBuffer.getCharCount()) return 2;
 
+  // Use the compiled grammar if available.
+  if (this->currentProcessingIndex == 0) this->prepareDfa();
+  if (this->dfa != 0) return this->processCompiled();
+
   // Get the processing character.
   WChar inputChar = this->inputBuffer.getChars()[this->currentProcessingIndex];
 
@@ -256,37 +362,7 @@ Int Lexer::process()
       ));
       // Choose one of the closed states.
       Int i = this->selectBestToken();
-      Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(this->states[i]->getTokenDefIndex());
-      // Check if the chosen token is not an ignored token.
-      TiInt *flags = this->grammarContext.getSymbolFlags(def);
-      if (!((flags == 0 ? 0 : flags->get()) & Data::Grammar::SymbolFlags::IGNORED_TOKEN)) {
-        // Has the token been clamped?
-        if (this->currentTokenClamped) {
-          // Raise a warning.
-          this->noticeSignal.emit(newSrdObj<Notices::TokenClampedNotice>(
-            newSrdObj<Data::SourceLocationRecord>(this->inputBuffer.getSourceLocation())
-          ));
-          this->currentTokenClamped = false;
-        }
-        // Set token properties.
-        TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
-        if (handler == 0) {
-          this->lastToken.setId(def->getId());
-          this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
-          this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
-          this->lastToken.setAsKeyword(false);
-        } else {
-          handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
-                                this->states[i]->getTokenLength(), this->inputBuffer.getSourceLocation());
-        }
-        // Inform the caller that there is a new token.
-        r |= 1;
-      }
-      // Reuse the remaining characters in the input buffer.
-      this->inputBuffer.remove(this->states[i]->getTokenLength());
-      // Set the processing index to -1 since the character we are currently processing is shifted
-      // out of the buffer.
-      this->currentProcessingIndex = -1;
+      if (this->acceptToken(this->states[i]->getTokenDefIndex(), this->states[i]->getTokenLength())) r |= 1;
       // Delete all the states.
       for (Int i = 0; i < this->stateCount; ++i) {
         this->recycledStates[this->recycledStateCount++] = this->states[i];
@@ -337,62 +413,104 @@ Int Lexer::process()
   } else if (closedStateCount > 0) {
     // Choose one of the closed states.
     Int i = this->selectBestToken();
-    Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(this->states[i]->getTokenDefIndex());
-    // Check if the chosen token is not an ignored token.
-    TiInt *flags = this->grammarContext.getSymbolFlags(def);
-    if (!((flags == 0 ? 0 : flags->get()) & Data::Grammar::SymbolFlags::IGNORED_TOKEN)) {
-      // Has the token been clamped?
-      if (this->currentTokenClamped) {
-        // Raise a warning.
-        this->noticeSignal.emit(newSrdObj<Notices::TokenClampedNotice>(
-          newSrdObj<Data::SourceLocationRecord>(this->inputBuffer.getSourceLocation())
-        ));
-        this->currentTokenClamped = false;
-      }
-      // Set token properties.
-      TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
-      if (handler == 0) {
-        this->lastToken.setId(def->getId());
-        this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
-        this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
-      } else {
-        handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
-                              this->states[i]->getTokenLength(), this->inputBuffer.getSourceLocation());
-      }
-      // Inform the caller that there is a new token.
-      r |= 1;
-    }
-    // Reuse the remaining characters in the input buffer.
-    this->inputBuffer.remove(this->states[i]->getTokenLength());
-    // Set the processing index to -1 since the character we are currently processing is shifted
-    // out of the buffer.
-    this->currentProcessingIndex = -1;
+    if (this->acceptToken(this->states[i]->getTokenDefIndex(), this->states[i]->getTokenLength())) r |= 1;
     // Delete all the states.
     for (Int i = 0; i < this->stateCount; ++i) {
       this->recycledStates[this->recycledStateCount++] = this->states[i];
     }
     this->stateCount = 0;
   } else {
-    // No states are still alive, so move the first character in the input buffer to the error
-    // buffer and try again.
-    Str err;
-    Data::SourceLocationRecord sl;
-    if (this->inputBuffer.getChars()[0] != FILE_TERMINATOR) {
-      err.assign(this->inputBuffer.getChars(), 1);
-      sl = this->inputBuffer.getSourceLocation();
-      this->inputBuffer.remove(1);
+    this->rejectChar();
+  }
+
+  return r | this->finishProcessingChar(closedStateCount > 0, openStateCount > 0);
+}
+
+
+/**
+ * Accept the token with the given definition and length at the start of the
+ * input buffer, then remove its characters from the buffer so that the
+ * remaining characters get processed again for the next token. Ignored tokens
+ * are dropped without being reported.
+ *
+ * @return Returns true if the token was written into lastToken, false if it
+ *         was ignored.
+ */
+Bool Lexer::acceptToken(Int tokenDefIndex, Int tokenLength)
+{
+  Bool accepted = false;
+  Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(tokenDefIndex);
+  // Check if the chosen token is not an ignored token.
+  TiInt *flags = this->grammarContext.getSymbolFlags(def);
+  if (!((flags == 0 ? 0 : flags->get()) & Data::Grammar::SymbolFlags::IGNORED_TOKEN)) {
+    // Has the token been clamped?
+    if (this->currentTokenClamped) {
+      // Raise a warning.
+      this->noticeSignal.emit(newSrdObj<Notices::TokenClampedNotice>(
+        newSrdObj<Data::SourceLocationRecord>(this->inputBuffer.getSourceLocation())
+      ));
+      this->currentTokenClamped = false;
     }
-    // limit the error text to LEXER_ERROR_BUFFER_MAX_CHARACTERS
-    if (this->errorBuffer.getTextLength() < LEXER_ERROR_BUFFER_MAX_CHARACTERS) {
-      this->errorBuffer.appendText(err, sl);
+    // Set token properties.
+    TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
+    if (handler == 0) {
+      this->lastToken.setId(def->getId());
+      this->lastToken.setText(this->inputBuffer.getChars(), tokenLength);
+      this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
+      this->lastToken.setAsKeyword(false);
+    } else {
+      handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
+                            tokenLength, this->inputBuffer.getSourceLocation());
     }
-    // Set the processing index to -1 since the character we are currently processing is shifted
-    // out of the buffer.
-    this->currentProcessingIndex = -1;
+    accepted = true;
+  }
+  // Reuse the remaining characters in the input buffer.
+  this->inputBuffer.remove(tokenLength);
+  // Set the processing index to -1 since the character we are currently processing is shifted
+  // out of the buffer.
+  this->currentProcessingIndex = -1;
+  return accepted;
+}
+
+
+/**
+ * Move the first character in the input buffer to the error buffer, to be
+ * called when no token can start at that character.
+ */
+void Lexer::rejectChar()
+{
+  // No states are still alive, so move the first character in the input buffer to the error
+  // buffer and try again.
+  Str err;
+  Data::SourceLocationRecord sl;
+  if (this->inputBuffer.getChars()[0] != FILE_TERMINATOR) {
+    err.assign(this->inputBuffer.getChars(), 1);
+    sl = this->inputBuffer.getSourceLocation();
+    this->inputBuffer.remove(1);
+  }
+  // limit the error text to LEXER_ERROR_BUFFER_MAX_CHARACTERS
+  if (this->errorBuffer.getTextLength() < LEXER_ERROR_BUFFER_MAX_CHARACTERS) {
+    this->errorBuffer.appendText(err, sl);
   }
+  // Set the processing index to -1 since the character we are currently processing is shifted
+  // out of the buffer.
+  this->currentProcessingIndex = -1;
+}
+
 
+/**
+ * Finish processing the current character by reporting the error buffer if a
+ * token was found or the file is finished, and moving to the next character.
+ *
+ * @param closedStateFound Whether a token was found at the current character.
+ * @param openStateFound Whether a longer token can still be found.
+ * @return Returns 2 if the input buffer needs more characters, 0 otherwise,
+ *         to be combined with process's return value.
+ */
+Int Lexer::finishProcessingChar(Bool closedStateFound, Bool openStateFound)
+{
   // Is it time to report any characters in the error buffer (found a token or finished the file)?
-  if (closedStateCount > 0 ||
+  if (closedStateFound ||
       (this->inputBuffer.getCharCount()==1 &&
        this->inputBuffer.getChars()[0]==FILE_TERMINATOR)) {
     // Report any characters in the error buffer.
@@ -412,14 +530,12 @@ Int Lexer::process()
   if (this->inputBuffer.getCharCount() == 1 &&
       this->inputBuffer.getChars()[0] == FILE_TERMINATOR) {
     // There should be no more open states at this point.
-    ASSERT(openStateCount == 0);
+    ASSERT(!openStateFound);
     this->inputBuffer.clear();
   }
 
   // Check if we need more characters to be added to the input buffer.
-  if (this->currentProcessingIndex >= this->inputBuffer.getCharCount()) r |= 2;
-
-  return r;
+  return this->currentProcessingIndex >= this->inputBuffer.getCharCount() ? 2 : 0;
 }
 
 
@@ -958,37 +1074,9 @@ Int Lexer::selectBestToken()
         // choose the longer token
         index = i;
       } else if (lengthI == lengthIndex) {
-        // get token definition index
-        Int tokenDefinitionI = this->states[i]->getTokenDefIndex();
-        Int tokenDefinitionIndex = this->states[index]->getTokenDefIndex();
-        // check which state is for a constant token
-        Bool isConstantI, isConstantIndex;
-
-        // Check if tokenDefinitionI refers to a const term.
-        Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(tokenDefinitionI);
-        ASSERT(def->isA<Data::Grammar::SymbolDefinition>());
-        Data::Grammar::Term *head = def->getTerm().get();
-        ASSERT(head->isDerivedFrom<Data::Grammar::Term>());
-        if (head->isA<Data::Grammar::ConstTerm>()) isConstantI = true;
-        else isConstantI = false;
-
-        // Check if tokenDeinitionIndex refers to a const term.
-        def = this->getSymbolDefinition(tokenDefinitionIndex);
-        ASSERT(def->isA<Data::Grammar::SymbolDefinition>());
-        head = def->getTerm().get();
-        ASSERT(head->isDerivedFrom<Data::Grammar::Term>());
-        if (head->isA<Data::Grammar::ConstTerm>()) isConstantIndex = true;
-        else isConstantIndex = false;
-
-        // check if one token is constant and the other is not
-        if (isConstantI && !isConstantIndex) {
-          // choose the constant token
+        // choose by token definition
+        if (this->isPreferredTokenDef(this->states[i]->getTokenDefIndex(), this->states[index]->getTokenDefIndex())) {
           index = i;
-        } else if (isConstantI == isConstantIndex) {
-          if (tokenDefinitionI < tokenDefinitionIndex) {
-            // choose the higher token definition
-            index = i;
-          }
         }
       }
     }
@@ -998,6 +1086,49 @@ Int Lexer::selectBestToken()
 }
 
 
+/**
+ * Check which of two token definitions should be selected if both matched
+ * tokens of the same length. A definition with a constant string term is
+ * preferred over a definition that isn't. If both or none of them are
+ * constant strings, the one that comes first in the token definitions array is
+ * preferred.
+ *
+ * @return Returns true if the first definition is preferred, false otherwise.
+ */
+Bool Lexer::isPreferredTokenDef(Int tokenDefIndex1, Int tokenDefIndex2)
+{
+  // check which definition is for a constant token
+  Bool isConstant1, isConstant2;
+
+  // Check if tokenDefIndex1 refers to a const term.
+  Data::Grammar::SymbolDefinition *def = this->getSymbolDefinition(tokenDefIndex1);
+  ASSERT(def->isA<Data::Grammar::SymbolDefinition>());
+  Data::Grammar::Term *head = def->getTerm().get();
+  ASSERT(head->isDerivedFrom<Data::Grammar::Term>());
+  if (head->isA<Data::Grammar::ConstTerm>()) isConstant1 = true;
+  else isConstant1 = false;
+
+  // Check if tokenDefIndex2 refers to a const term.
+  def = this->getSymbolDefinition(tokenDefIndex2);
+  ASSERT(def->isA<Data::Grammar::SymbolDefinition>());
+  head = def->getTerm().get();
+  ASSERT(head->isDerivedFrom<Data::Grammar::Term>());
+  if (head->isA<Data::Grammar::ConstTerm>()) isConstant2 = true;
+  else isConstant2 = false;
+
+  // check if one token is constant and the other is not
+  if (isConstant1 && !isConstant2) {
+    // choose the constant token
+    return true;
+  } else if (isConstant1 == isConstant2) {
+    // choose the higher token definition
+    return tokenDefIndex1 < tokenDefIndex2;
+  } else {
+    return false;
+  }
+}
+
+
 /**
  * Clear the states stack and all other buffers to the state of the machine
  * before parsing started. Token and char group definitions will not be
@@ -1027,6 +1158,11 @@ void Lexer::clear()
   this->inputBuffer.clear();
   this->errorBuffer.clear();
 
+  this->dfa.reset();
+  this->dfaState = Data::Grammar::LexerDfa::DEAD_STATE;
+  this->dfaTokenDefIndex = -1;
+  this->dfaTokenLength = 0;
+
   this->currentProcessingIndex = 0;
   this->currentTokenClamped = false;
   this->lastToken.setId(UNKNOWN_ID);
@@ -1051,4 +1187,759 @@ LexerState* Lexer::createState()
   }
 }
 
+
+//==============================================================================
+// Compiled Grammar Functions
+
+Bool Lexer::DfaConfig::operator<(DfaConfig const &config) const
+{
+  if (this->tokenDefIndex != config.tokenDefIndex) return this->tokenDefIndex < config.tokenDefIndex;
+  if (this->levels.size() != config.levels.size()) return this->levels.size() < config.levels.size();
+  for (Word i = 0; i < this->levels.size(); ++i) {
+    if (this->levels[i].term != config.levels[i].term) {
+      return std::less<Data::Grammar::Term*>()(this->levels[i].term, config.levels[i].term);
+    }
+    if (this->levels[i].posId != config.levels[i].posId) return this->levels[i].posId < config.levels[i].posId;
+  }
+  return false;
+}
+
+
+Bool Lexer::DfaConfig::operator==(DfaConfig const &config) const
+{
+  if (this->tokenDefIndex != config.tokenDefIndex || this->levels.size() != config.levels.size()) return false;
+  for (Word i = 0; i < this->levels.size(); ++i) {
+    if (this->levels[i].term != config.levels[i].term || this->levels[i].posId != config.levels[i].posId) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+/**
+ * Set the DFA to be used for the next token. The DFA is cached in the lexer
+ * module and is dropped whenever the grammar caches are cleared, in which case
+ * a new DFA is created, unless a snapshot of the same grammar was saved
+ * previously. A new DFA expands its states on demand, unless it's going to be
+ * saved in a snapshot, in which case it's compiled completely. If the grammar
+ * can't be compiled the lexer falls back to interpreting the grammar terms
+ * directly.
+ */
+void Lexer::prepareDfa()
+{
+  auto lexerModule = static_cast<Data::Grammar::LexerModule*>(this->grammarContext.getModule());
+  if (lexerModule->getDfa() == 0) {
+    SharedPtr<Data::Grammar::LexerDfa> dfa;
+    Bool useSnapshot = GrammarSnapshot::isEnabled();
+    LongWord grammarHash = 0;
+    if (useSnapshot) {
+      try {
+        grammarHash = this->computeDfaGrammarHash(lexerModule);
+        dfa = GrammarSnapshot::loadLexerDfa(grammarHash, lexerModule->getCount());
+      } catch (Exception &e) {
+        // Incomplete grammars can't be compiled anyway.
+        useSnapshot = false;
+      }
+    }
+    if (dfa == 0) {
+      if (useSnapshot) {
+        dfa = this->compileDfa(lexerModule);
+        GrammarSnapshot::saveLexerDfa(grammarHash, dfa.get());
+      } else {
+        dfa = this->createDfa(lexerModule);
+      }
+    } else {
+      LOG(LogLevel::LEXER_MAJOR, S("Loaded lexer DFA from grammar snapshot. States: ") << dfa->getStateCount());
+    }
+    lexerModule->setDfa(dfa);
+  }
+  if (lexerModule->getDfa()->isValid()) this->dfa = lexerModule->getDfa();
+  else this->dfa.reset();
+}
+
+
+/**
+ * This is the equivalent of process() when using the compiled DFA instead of
+ * the grammar interpreter. Instead of keeping a list of states it only needs
+ * to keep the current DFA state and the best token found so far. The results
+ * are identical to those of process().
+ *
+ * @sa process()
+ */
+Int Lexer::processCompiled()
+{
+  // Get the processing character.
+  WChar inputChar = this->inputBuffer.getChars()[this->currentProcessingIndex];
+
+  // Update the DFA state. If the current state accepts a token then this is the best token found so far since it's
+  // longer than any previously found token. Entries of the DFA that weren't computed yet are computed now.
+  if (this->currentProcessingIndex == 0) {
+    this->dfaState = Data::Grammar::LexerDfa::START_STATE;
+    this->dfaTokenLength = 0;
+  }
+  try {
+    if (this->currentProcessingIndex != 0) {
+      Int acceptedDefIndex = this->dfa->getAcceptedDefIndex(this->dfaState);
+      if (acceptedDefIndex == Data::Grammar::LexerDfa::UNKNOWN_ACCEPTANCE) {
+        acceptedDefIndex = this->computeDfaAcceptance(this->dfa.get(), this->dfaState);
+      }
+      if (acceptedDefIndex != -1) {
+        this->dfaTokenDefIndex = acceptedDefIndex;
+        this->dfaTokenLength = this->currentProcessingIndex;
+      }
+    }
+    Int charClass = this->dfa->getClass(inputChar);
+    Int nextState = this->dfa->getNextState(this->dfaState, charClass);
+    if (nextState == Data::Grammar::LexerDfa::UNKNOWN_TRANSITION) {
+      nextState = this->computeDfaTransition(this->dfa.get(), this->dfaState, charClass);
+    }
+    this->dfaState = nextState;
+  } catch (Exception &e) {
+    // The grammar can't be compiled, so switch to the interpreter and restart the current token. The characters of
+    // the current token are still in the input buffer since no token is accepted before the DFA state dies.
+    LOG(LogLevel::LEXER_MAJOR, S("Falling back to lexer grammar interpreter: ") << e.getVerboseErrorMessage());
+    static_cast<Data::Grammar::LexerModule*>(this->grammarContext.getModule())->setDfa(
+      newSrdObj<Data::Grammar::LexerDfa>()
+    );
+    this->dfa.reset();
+    this->dfaState = Data::Grammar::LexerDfa::DEAD_STATE;
+    this->dfaTokenLength = 0;
+    this->currentProcessingIndex = 0;
+    return this->process();
+  }
+
+  Int r = 0;
+
+  Bool hasOpenState = this->dfaState != Data::Grammar::LexerDfa::DEAD_STATE;
+  Bool hasClosedState = this->dfaTokenLength != 0;
+  if (hasOpenState) {
+    // If the buffer is full and we have a closed state, then we should choose it, otherwise, wait until the open
+    // state is closed or dead.
+    if (hasClosedState && this->inputBuffer.isFull() == true &&
+        this->currentProcessingIndex >= this->inputBuffer.getCharCount()-1) {
+      // Raise a warning.
+      this->noticeSignal.emit(newSrdObj<Notices::BufferFullNotice>(
+        newSrdObj<Data::SourceLocationRecord>(this->inputBuffer.getSourceLocation())
+      ));
+      if (this->acceptToken(this->dfaTokenDefIndex, this->dfaTokenLength)) r |= 1;
+      this->dfaState = Data::Grammar::LexerDfa::DEAD_STATE;
+      this->dfaTokenLength = 0;
+    }
+  } else if (hasClosedState) {
+    if (this->acceptToken(this->dfaTokenDefIndex, this->dfaTokenLength)) r |= 1;
+    this->dfaTokenLength = 0;
+  } else {
+    this->rejectChar();
+  }
+
+  return r | this->finishProcessingChar(hasClosedState, hasOpenState);
+}
+
+
+/**
+ * Create a DFA for the token definitions of the given lexer module. Only the
+ * character classes and the start state are prepared here; transitions and
+ * accepted tokens are computed by computeDfaTransition and
+ * computeDfaAcceptance the first time the input needs them, so the startup
+ * cost doesn't depend on the size of the grammar. Input
+ * characters are grouped into classes of characters that are treated
+ * identically by all token definitions, so the interpreter only needs to run
+ * once per class.
+ *
+ * @return Returns the new DFA, or an invalid DFA if the grammar couldn't be
+ *         compiled, in which case the lexer should fall back to interpreting
+ *         the grammar.
+ */
+SharedPtr<Data::Grammar::LexerDfa> Lexer::createDfa(Data::Grammar::LexerModule *lexerModule)
+{
+  try {
+    // Prepare the start configurations and collect the boundaries of character classes.
+    DfaConfigSet startConfigs;
+    std::vector<WChar> classStarts;
+    std::vector<Data::Grammar::Term*> visitedTerms;
+    classStarts.push_back(std::numeric_limits<WChar>::min());
+    for (Word i = 0; i < lexerModule->getCount(); i++) {
+      // Skip non tokens and non-root tokens.
+      TiObject *obj = lexerModule->getElement(i);
+      if (obj == 0 || !obj->isA<Data::Grammar::SymbolDefinition>()) continue;
+      Data::Grammar::SymbolDefinition *def = static_cast<Data::Grammar::SymbolDefinition*>(obj);
+      TiInt *flags = this->grammarContext.getSymbolFlags(def);
+      if (!((flags == 0 ? 0 : flags->get()) & Data::Grammar::SymbolFlags::ROOT_TOKEN)) continue;
+      if (def->getTerm() == 0) {
+        throw EXCEPTION(GenericException, S("Token definition formula is not set yet."));
+      }
+      DfaConfig config;
+      config.tokenDefIndex = i;
+      config.levels.push_back(LexerState::Level(0, def->getTerm().get()));
+      startConfigs.push_back(config);
+      this->collectDfaBoundaries(def->getTerm().get(), classStarts, visitedTerms);
+    }
+    if (startConfigs.size() == 0) {
+      throw EXCEPTION(GenericException, S("Lexer module has no root tokens."));
+    }
+    std::sort(classStarts.begin(), classStarts.end());
+    classStarts.erase(std::unique(classStarts.begin(), classStarts.end()), classStarts.end());
+
+    // Each DFA state is the set of interpreter configurations reached after a given input.
+    auto buildData = newSrdObj<DfaBuildData>();
+    buildData->stateConfigs.push_back(std::vector<Int>());
+    buildData->stateIndexes[buildData->stateConfigs.back()] = Data::Grammar::LexerDfa::DEAD_STATE;
+    buildData->stateConfigs.push_back(std::vector<Int>());
+    this->internDfaConfigs(buildData.get(), startConfigs, buildData->stateConfigs.back());
+    std::sort(buildData->stateConfigs.back().begin(), buildData->stateConfigs.back().end());
+    buildData->stateIndexes[buildData->stateConfigs.back()] = Data::Grammar::LexerDfa::START_STATE;
+
+    LOG(LogLevel::LEXER_MAJOR, S("Created lexer DFA. Classes: ") << classStarts.size());
+
+    return newSrdObj<Data::Grammar::LexerDfa>(std::move(classStarts), buildData);
+  } catch (Exception &e) {
+    LOG(LogLevel::LEXER_MAJOR, S("Falling back to lexer grammar interpreter: ") << e.getVerboseErrorMessage());
+    return newSrdObj<Data::Grammar::LexerDfa>();
+  }
+}
+
+
+/**
+ * Compile the token definitions of the given lexer module into a complete
+ * and minimized DFA by computing all reachable states upfront. This is only
+ * needed when the DFA is saved in a grammar snapshot, otherwise the DFA is
+ * computed incrementally while scanning.
+ *
+ * @return Returns the compiled DFA, or an invalid DFA if the grammar couldn't
+ *         be compiled.
+ */
+SharedPtr<Data::Grammar::LexerDfa> Lexer::compileDfa(Data::Grammar::LexerModule *lexerModule)
+{
+  auto dfa = this->createDfa(lexerModule);
+  if (!dfa->isValid()) return dfa;
+  try {
+    // New states are always added after the current one, so a single pass covers all of them.
+    for (Int state = Data::Grammar::LexerDfa::START_STATE; state < dfa->getStateCount(); ++state) {
+      if (dfa->getAcceptedDefIndex(state) == Data::Grammar::LexerDfa::UNKNOWN_ACCEPTANCE) {
+        this->computeDfaAcceptance(dfa.get(), state);
+      }
+      for (Int charClass = 0; charClass < dfa->getClassCount(); ++charClass) {
+        if (dfa->getNextState(state, charClass) == Data::Grammar::LexerDfa::UNKNOWN_TRANSITION) {
+          this->computeDfaTransition(dfa.get(), state, charClass);
+        }
+      }
+    }
+
+    LOG(LogLevel::LEXER_MAJOR, S("Compiled lexer grammar. States: ") << dfa->getStateCount()
+        << S(", Classes: ") << dfa->getClassCount());
+
+    std::vector<Int> transitions = dfa->getTransitions();
+    std::vector<Int> acceptedDefIndexes = dfa->getAcceptedDefIndexes();
+    this->minimizeDfa(transitions, acceptedDefIndexes, dfa->getClassCount());
+
+    LOG(LogLevel::LEXER_MAJOR, S("Minimized lexer DFA states: ") << acceptedDefIndexes.size());
+
+    return newSrdObj<Data::Grammar::LexerDfa>(
+      dfa->getClassStarts(), std::move(transitions), std::move(acceptedDefIndexes)
+    );
+  } catch (Exception &e) {
+    LOG(LogLevel::LEXER_MAJOR, S("Falling back to lexer grammar interpreter: ") << e.getVerboseErrorMessage());
+    return newSrdObj<Data::Grammar::LexerDfa>();
+  }
+}
+
+
+/**
+ * Compute the token accepted at the given state, which is the preferred token
+ * among the interpreter configurations of that state that reached the end of
+ * their tokens.
+ *
+ * Throws if the grammar turns out to be impossible to compile, in which case
+ * the DFA must not be used anymore.
+ */
+Int Lexer::computeDfaAcceptance(Data::Grammar::LexerDfa *dfa, Int state)
+{
+  auto buildData = static_cast<DfaBuildData*>(dfa->getBuildData());
+  try {
+    // Closing configurations never consume the character, so any character class can be used.
+    Int acceptedDefIndex = -1;
+    for (auto configIndex : buildData->stateConfigs[state]) {
+      if (this->getDfaConfigStep(buildData, dfa->getClassStarts(), configIndex, 0).closed) {
+        Int defIndex = buildData->configDefIndexes[configIndex];
+        if (acceptedDefIndex == -1 || this->isPreferredTokenDef(defIndex, acceptedDefIndex)) {
+          acceptedDefIndex = defIndex;
+        }
+      }
+    }
+    dfa->setAcceptedDefIndex(state, acceptedDefIndex);
+    return acceptedDefIndex;
+  } catch (...) {
+    while (this->nextStateCount > 0) this->recycledStates[this->recycledStateCount++] = this->nextStates[--this->nextStateCount];
+    throw;
+  }
+}
+
+
+/**
+ * Compute the state reached from the given state by the given character class
+ * by applying that class on the interpreter configurations of the state. If
+ * the resulting set of configurations wasn't seen before it's added to the DFA
+ * as a new state whose transitions are unknown.
+ *
+ * Throws if the grammar turns out to be impossible to compile, in which case
+ * the DFA must not be used anymore.
+ */
+Int Lexer::computeDfaTransition(Data::Grammar::LexerDfa *dfa, Int state, Int charClass)
+{
+  Int stateAcceptedDefIndex = dfa->getAcceptedDefIndex(state);
+  if (stateAcceptedDefIndex == Data::Grammar::LexerDfa::UNKNOWN_ACCEPTANCE) {
+    stateAcceptedDefIndex = this->computeDfaAcceptance(dfa, state);
+  }
+  auto buildData = static_cast<DfaBuildData*>(dfa->getBuildData());
+  try {
+    // Apply the character class on all the configurations.
+    std::vector<Int> nextConfigs;
+    Int acceptedDefIndex = -1;
+    for (auto configIndex : buildData->stateConfigs[state]) {
+      auto const &step = this->getDfaConfigStep(buildData, dfa->getClassStarts(), configIndex, charClass);
+      if (step.closed) {
+        if (state == Data::Grammar::LexerDfa::START_STATE) {
+          throw EXCEPTION(GenericException, S("Token definitions accepting empty tokens can't be compiled."));
+        }
+        Int defIndex = buildData->configDefIndexes[configIndex];
+        if (acceptedDefIndex == -1 || this->isPreferredTokenDef(defIndex, acceptedDefIndex)) {
+          acceptedDefIndex = defIndex;
+        }
+      }
+      nextConfigs.insert(nextConfigs.end(), step.nextConfigIndexes.begin(), step.nextConfigIndexes.end());
+    }
+    // Closing states never consume the character, so the accepted token must be the same for all classes.
+    if (acceptedDefIndex != stateAcceptedDefIndex) {
+      throw EXCEPTION(GenericException, S("Inconsistent token acceptance while compiling lexer grammar."));
+    }
+    // Drop open configurations of the accepted definition if it prefers shorter tokens.
+    if (acceptedDefIndex != -1) {
+      TiInt *flags = this->grammarContext.getSymbolFlags(this->getSymbolDefinition(acceptedDefIndex));
+      if (flags != 0 && flags->get() & Data::Grammar::SymbolFlags::PREFER_SHORTER) {
+        nextConfigs.erase(std::remove_if(nextConfigs.begin(), nextConfigs.end(), [&](Int configIndex) {
+          return buildData->configDefIndexes[configIndex] == acceptedDefIndex;
+        }), nextConfigs.end());
+      }
+    }
+    std::sort(nextConfigs.begin(), nextConfigs.end());
+    nextConfigs.erase(std::unique(nextConfigs.begin(), nextConfigs.end()), nextConfigs.end());
+    // Find or create the target state.
+    Int nextState;
+    auto iter = buildData->stateIndexes.find(nextConfigs);
+    if (iter != buildData->stateIndexes.end()) {
+      nextState = iter->second;
+    } else {
+      if (dfa->getStateCount() >= LEXER_DFA_MAX_STATE_COUNT) {
+        throw EXCEPTION(GenericException, S("Lexer grammar exceeds the maximum DFA size."));
+      }
+      nextState = dfa->addState();
+      buildData->stateIndexes[nextConfigs] = nextState;
+      buildData->stateConfigs.push_back(std::move(nextConfigs));
+    }
+    dfa->setNextState(state, charClass, nextState);
+    return nextState;
+  } catch (...) {
+    while (this->nextStateCount > 0) this->recycledStates[this->recycledStateCount++] = this->nextStates[--this->nextStateCount];
+    throw;
+  }
+}
+
+
+void Lexer::internDfaConfigs(DfaBuildData *buildData, DfaConfigSet &configs, std::vector<Int> &indexes)
+{
+  for (auto &config : configs) {
+    auto iter = buildData->configIndexes.find(config);
+    if (iter != buildData->configIndexes.end()) {
+      indexes.push_back(iter->second);
+    } else {
+      Int index = buildData->internedConfigs.size();
+      buildData->configDefIndexes.push_back(config.tokenDefIndex);
+      buildData->configSteps.push_back(std::vector<DfaConfigStep>());
+      indexes.push_back(index);
+      buildData->internedConfigs.push_back(&buildData->configIndexes.emplace(std::move(config), index).first->first);
+    }
+  }
+}
+
+
+/**
+ * Get the result of applying the given character class on the given interned
+ * configuration, computing it the first time it's needed.
+ */
+Lexer::DfaConfigStep const& Lexer::getDfaConfigStep(
+  DfaBuildData *buildData, std::vector<WChar> const &classStarts, Int configIndex, Int charClass
+) {
+  if (buildData->configSteps[configIndex].size() == 0) {
+    buildData->configSteps[configIndex].resize(classStarts.size());
+  }
+  if (!buildData->configSteps[configIndex][charClass].computed) {
+    DfaConfigSet nextConfigs;
+    std::vector<Int> nextConfigIndexes;
+    Bool closed = this->stepDfaConfig(*buildData->internedConfigs[configIndex], classStarts[charClass], nextConfigs);
+    this->internDfaConfigs(buildData, nextConfigs, nextConfigIndexes);
+    // Interning can add more configurations, so the step is only looked up after it.
+    auto &step = buildData->configSteps[configIndex][charClass];
+    step.computed = true;
+    step.closed = closed;
+    step.nextConfigIndexes = std::move(nextConfigIndexes);
+  }
+  return buildData->configSteps[configIndex][charClass];
+}
+
+
+/**
+ * Recursively collect the boundaries of the character classes needed by the
+ * given term. A boundary is the first character that could be treated
+ * differently from the character preceding it.
+ */
+void Lexer::collectDfaBoundaries(
+  Data::Grammar::Term *term, std::vector<WChar> &boundaries, std::vector<Data::Grammar::Term*> &visitedTerms
+) {
+  if (std::find(visitedTerms.begin(), visitedTerms.end(), term) != visitedTerms.end()) return;
+  visitedTerms.push_back(term);
+
+  if (term->isA<Data::Grammar::ConstTerm>()) {
+    auto const &matchString = static_cast<Data::Grammar::ConstTerm*>(term)->getMatchString();
+    for (Int i = 0; i < matchString.getLength(); ++i) {
+      boundaries.push_back(matchString(i));
+      if (matchString(i) < std::numeric_limits<WChar>::max()) boundaries.push_back(matchString(i) + 1);
+    }
+  } else if (term->isA<Data::Grammar::CharGroupTerm>()) {
+    Data::Grammar::Reference *ref = static_cast<Data::Grammar::CharGroupTerm*>(term)->getCharGroupReference().get();
+    if (ref == 0) {
+      throw EXCEPTION(GenericException, S("Reference is null for CharGroupTerm."));
+    }
+    auto def = this->grammarContext.getReferencedCharGroup(ref);
+    if (def->getCharGroupUnit() == 0) {
+      throw EXCEPTION(GenericException, S("Character group formula is not set yet."));
+    }
+    this->collectDfaBoundaries(def->getCharGroupUnit().get(), boundaries);
+  } else if (term->isA<Data::Grammar::MultiplyTerm>()) {
+    auto childTerm = static_cast<Data::Grammar::MultiplyTerm*>(term)->getTerm().ti_cast_get<Data::Grammar::Term>();
+    if (childTerm == 0) {
+      throw EXCEPTION(GenericException, S("Multiply term with null or invalid child is found."));
+    }
+    this->collectDfaBoundaries(childTerm, boundaries, visitedTerms);
+  } else if (term->isA<Data::Grammar::AlternateTerm>() || term->isA<Data::Grammar::ConcatTerm>()) {
+    auto list = static_cast<Data::Grammar::ListTerm*>(term)->getTerms().s_cast_get<Data::Grammar::List>();
+    for (Int i = 0; i < list->getCount(); ++i) {
+      auto childTerm = ti_cast<Data::Grammar::Term>(list->getElement(i));
+      if (childTerm == 0) {
+        throw EXCEPTION(GenericException, S("Null child term found in a list term."));
+      }
+      this->collectDfaBoundaries(childTerm, boundaries, visitedTerms);
+    }
+  } else if (term->isA<Data::Grammar::ReferenceTerm>()) {
+    Data::Grammar::Reference *ref = static_cast<Data::Grammar::ReferenceTerm*>(term)->getReference().get();
+    if (ref == 0) {
+      throw EXCEPTION(GenericException, S("Reference is null for ReferenceTerm."));
+    }
+    auto def = this->grammarContext.getReferencedSymbol(ref);
+    if (def->findOwner<Data::Grammar::Module>() != this->grammarContext.getModule()) {
+      throw EXCEPTION(GenericException, S("Referencing terms in a different module is not supported."));
+    }
+    if (def->getTerm() == 0) {
+      throw EXCEPTION(GenericException, S("Referenced token definition formula is not set yet."));
+    }
+    this->collectDfaBoundaries(def->getTerm().get(), boundaries, visitedTerms);
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid token term type."));
+  }
+}
+
+
+void Lexer::collectDfaBoundaries(Data::Grammar::CharGroupUnit *unit, std::vector<WChar> &boundaries)
+{
+  if (unit->isA<Data::Grammar::SequenceCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::SequenceCharGroupUnit*>(unit);
+    boundaries.push_back(u->getStartCode());
+    if (u->getEndCode() < std::numeric_limits<WChar>::max()) boundaries.push_back(u->getEndCode() + 1);
+  } else if (unit->isA<Data::Grammar::RandomCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::RandomCharGroupUnit*>(unit);
+    for (Int i = 0; i < u->getCharListSize(); i++) {
+      boundaries.push_back(u->getCharList()[i]);
+      if (u->getCharList()[i] < std::numeric_limits<WChar>::max()) boundaries.push_back(u->getCharList()[i] + 1);
+    }
+  } else if (unit->isA<Data::Grammar::UnionCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::UnionCharGroupUnit*>(unit);
+    for (Int i = 0; i < static_cast<Int>(u->getCharGroupUnits()->size()); i++) {
+      this->collectDfaBoundaries(u->getCharGroupUnits()->at(i).get(), boundaries);
+    }
+  } else if (unit->isA<Data::Grammar::InvertCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::InvertCharGroupUnit*>(unit);
+    if (u->getChildCharGroupUnit() == 0) {
+      throw EXCEPTION(GenericException, S("Invert char group unit is not configured yet."));
+    }
+    this->collectDfaBoundaries(u->getChildCharGroupUnit().get(), boundaries);
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid char group type."));
+  }
+}
+
+
+/**
+ * Compute a hash of the lexer module that changes whenever the DFA compiled
+ * from it would change. The hash covers the Alusus version, the flags and
+ * order of the token definitions, and the structure of their terms including
+ * character groups, constant strings, and multiply bounds. It's used as the
+ * key of grammar snapshots, so it needs to be much cheaper than compileDfa.
+ */
+LongWord Lexer::computeDfaGrammarHash(Data::Grammar::LexerModule *lexerModule)
+{
+  LongWord hash = GrammarSnapshot::getVersionHash();
+  std::vector<Data::Grammar::Term*> visitedTerms;
+  for (Word i = 0; i < lexerModule->getCount(); i++) {
+    TiObject *obj = lexerModule->getElement(i);
+    if (obj == 0 || !obj->isA<Data::Grammar::SymbolDefinition>()) continue;
+    Data::Grammar::SymbolDefinition *def = static_cast<Data::Grammar::SymbolDefinition*>(obj);
+    TiInt *flags = this->grammarContext.getSymbolFlags(def);
+    Int flagsValue = flags == 0 ? 0 : flags->get();
+    if (!(flagsValue & Data::Grammar::SymbolFlags::ROOT_TOKEN)) continue;
+    if (def->getTerm() == 0) {
+      throw EXCEPTION(GenericException, S("Token definition formula is not set yet."));
+    }
+    Lexer::hashDfaValue(hash, i);
+    Lexer::hashDfaValue(hash, flagsValue);
+    this->hashDfaTerm(def->getTerm().get(), hash, visitedTerms);
+  }
+  return hash;
+}
+
+
+void Lexer::hashDfaTerm(
+  Data::Grammar::Term *term, LongWord &hash, std::vector<Data::Grammar::Term*> &visitedTerms
+) {
+  // Terms that are visited again, through references, are hashed by their visit order to avoid infinite recursion.
+  auto iter = std::find(visitedTerms.begin(), visitedTerms.end(), term);
+  if (iter != visitedTerms.end()) {
+    Lexer::hashDfaValue(hash, 0);
+    Lexer::hashDfaValue(hash, iter - visitedTerms.begin());
+    return;
+  }
+  visitedTerms.push_back(term);
+
+  if (term->isA<Data::Grammar::ConstTerm>()) {
+    auto const &matchString = static_cast<Data::Grammar::ConstTerm*>(term)->getMatchString();
+    Lexer::hashDfaValue(hash, 1);
+    Lexer::hashDfaValue(hash, matchString.getLength());
+    for (Int i = 0; i < matchString.getLength(); ++i) Lexer::hashDfaValue(hash, matchString(i));
+  } else if (term->isA<Data::Grammar::CharGroupTerm>()) {
+    Data::Grammar::Reference *ref = static_cast<Data::Grammar::CharGroupTerm*>(term)->getCharGroupReference().get();
+    if (ref == 0) {
+      throw EXCEPTION(GenericException, S("Reference is null for CharGroupTerm."));
+    }
+    auto def = this->grammarContext.getReferencedCharGroup(ref);
+    if (def->getCharGroupUnit() == 0) {
+      throw EXCEPTION(GenericException, S("Character group formula is not set yet."));
+    }
+    Lexer::hashDfaValue(hash, 2);
+    this->hashDfaCharGroupUnit(def->getCharGroupUnit().get(), hash);
+  } else if (term->isA<Data::Grammar::MultiplyTerm>()) {
+    auto multiplyTerm = static_cast<Data::Grammar::MultiplyTerm*>(term);
+    auto childTerm = multiplyTerm->getTerm().ti_cast_get<Data::Grammar::Term>();
+    if (childTerm == 0) {
+      throw EXCEPTION(GenericException, S("Multiply term with null or invalid child is found."));
+    }
+    Lexer::hashDfaValue(hash, 3);
+    Lexer::hashDfaValue(
+      hash, multiplyTerm->getMin() == 0 ? -1 : this->grammarContext.getMultiplyTermMin(multiplyTerm)->get()
+    );
+    Lexer::hashDfaValue(
+      hash, multiplyTerm->getMax() == 0 ? -1 : this->grammarContext.getMultiplyTermMax(multiplyTerm)->get()
+    );
+    this->hashDfaTerm(childTerm, hash, visitedTerms);
+  } else if (term->isA<Data::Grammar::AlternateTerm>() || term->isA<Data::Grammar::ConcatTerm>()) {
+    auto list = static_cast<Data::Grammar::ListTerm*>(term)->getTerms().s_cast_get<Data::Grammar::List>();
+    Lexer::hashDfaValue(hash, term->isA<Data::Grammar::AlternateTerm>() ? 4 : 5);
+    Lexer::hashDfaValue(hash, list->getCount());
+    for (Int i = 0; i < list->getCount(); ++i) {
+      auto childTerm = ti_cast<Data::Grammar::Term>(list->getElement(i));
+      if (childTerm == 0) {
+        throw EXCEPTION(GenericException, S("Null child term found in a list term."));
+      }
+      this->hashDfaTerm(childTerm, hash, visitedTerms);
+    }
+  } else if (term->isA<Data::Grammar::ReferenceTerm>()) {
+    Data::Grammar::Reference *ref = static_cast<Data::Grammar::ReferenceTerm*>(term)->getReference().get();
+    if (ref == 0) {
+      throw EXCEPTION(GenericException, S("Reference is null for ReferenceTerm."));
+    }
+    auto def = this->grammarContext.getReferencedSymbol(ref);
+    if (def->getTerm() == 0) {
+      throw EXCEPTION(GenericException, S("Referenced token definition formula is not set yet."));
+    }
+    Lexer::hashDfaValue(hash, 6);
+    this->hashDfaTerm(def->getTerm().get(), hash, visitedTerms);
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid token term type."));
+  }
+}
+
+
+void Lexer::hashDfaCharGroupUnit(Data::Grammar::CharGroupUnit *unit, LongWord &hash)
+{
+  if (unit->isA<Data::Grammar::SequenceCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::SequenceCharGroupUnit*>(unit);
+    Lexer::hashDfaValue(hash, 1);
+    Lexer::hashDfaValue(hash, u->getStartCode());
+    Lexer::hashDfaValue(hash, u->getEndCode());
+  } else if (unit->isA<Data::Grammar::RandomCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::RandomCharGroupUnit*>(unit);
+    Lexer::hashDfaValue(hash, 2);
+    Lexer::hashDfaValue(hash, u->getCharListSize());
+    for (Int i = 0; i < u->getCharListSize(); i++) Lexer::hashDfaValue(hash, u->getCharList()[i]);
+  } else if (unit->isA<Data::Grammar::UnionCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::UnionCharGroupUnit*>(unit);
+    Lexer::hashDfaValue(hash, 3);
+    Lexer::hashDfaValue(hash, u->getCharGroupUnits()->size());
+    for (Int i = 0; i < static_cast<Int>(u->getCharGroupUnits()->size()); i++) {
+      this->hashDfaCharGroupUnit(u->getCharGroupUnits()->at(i).get(), hash);
+    }
+  } else if (unit->isA<Data::Grammar::InvertCharGroupUnit>()) {
+    auto u = static_cast<Data::Grammar::InvertCharGroupUnit*>(unit);
+    if (u->getChildCharGroupUnit() == 0) {
+      throw EXCEPTION(GenericException, S("Invert char group unit is not configured yet."));
+    }
+    Lexer::hashDfaValue(hash, 4);
+    this->hashDfaCharGroupUnit(u->getChildCharGroupUnit().get(), hash);
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid char group type."));
+  }
+}
+
+
+/**
+ * Apply the given character on the given configuration using the grammar
+ * interpreter, adding the resulting open configurations to the given set.
+ *
+ * @return Returns true if the configuration reached the end of its token
+ *         before the given character, false otherwise.
+ */
+Bool Lexer::stepDfaConfig(DfaConfig const &config, WChar inputChar, DfaConfigSet &nextConfigs)
+{
+  auto state = this->createState();
+  state->setTokenDefIndex(config.tokenDefIndex);
+  for (auto const &level : config.levels) state->pushTermLevel(level.posId, level.term);
+  state->setTokenLength(0);
+
+  Bool closed = false;
+  try {
+    switch (this->processState(state, inputChar, -1)) {
+      case CONTINUE_NEW_CHAR:
+        if (state->getLevelCount() == 0) {
+          throw EXCEPTION(GenericException, S("Tokens ending without a following character can't be compiled."));
+        }
+        this->addDfaConfig(state, nextConfigs);
+        break;
+      case CONTINUE_SAME_CHAR:
+        closed = true;
+        break;
+      default:
+        break;
+    }
+  } catch (...) {
+    this->recycledStates[this->recycledStateCount++] = state;
+    throw;
+  }
+  this->recycledStates[this->recycledStateCount++] = state;
+
+  // Add any states that were branched out during processing.
+  while (this->nextStateCount > 0) {
+    auto nextState = this->nextStates[--this->nextStateCount];
+    this->addDfaConfig(nextState, nextConfigs);
+    this->recycledStates[this->recycledStateCount++] = nextState;
+  }
+
+  return closed;
+}
+
+
+/**
+ * Add a configuration representing the given state to the given set. Iteration
+ * counts of unbounded multiply terms are capped at the minimum occurances
+ * since higher counts don't affect processing. This keeps the number of
+ * distinct configurations, and hence DFA states, finite.
+ */
+void Lexer::addDfaConfig(LexerState *state, DfaConfigSet &configs)
+{
+  DfaConfig config;
+  config.tokenDefIndex = state->getTokenDefIndex();
+  for (Word i = 0; i < state->getLevelCount(); ++i) {
+    LexerState::Level level = state->refLevel(i);
+    if (level.term->isA<Data::Grammar::MultiplyTerm>()) {
+      auto multiplyTerm = static_cast<Data::Grammar::MultiplyTerm*>(level.term);
+      if (multiplyTerm->getMax() == 0) {
+        Int min = multiplyTerm->getMin() == 0 ? 0 : this->grammarContext.getMultiplyTermMin(multiplyTerm)->get();
+        if (level.posId > min) level.posId = min;
+      }
+    }
+    config.levels.push_back(level);
+  }
+  configs.push_back(std::move(config));
+}
+
+
+/**
+ * Minimize the DFA by iteratively refining a partition of the states until
+ * states within each block have the same accepted token and go to the same
+ * blocks for all character classes. The dead and start states keep their
+ * indexes.
+ */
+void Lexer::minimizeDfa(std::vector<Int> &transitions, std::vector<Int> &acceptedDefIndexes, Int classCount)
+{
+  Int stateCount = acceptedDefIndexes.size();
+
+  // Initial partitioning by accepted token, keeping the dead state in its own block.
+  std::vector<Int> blocks(stateCount);
+  Int blockCount;
+  {
+    std::map<std::pair<Int, Bool>, Int> initialBlocks;
+    for (Int state = 0; state < stateCount; ++state) {
+      auto key = std::make_pair(acceptedDefIndexes[state], state == Data::Grammar::LexerDfa::DEAD_STATE);
+      blocks[state] = initialBlocks.emplace(key, initialBlocks.size()).first->second;
+    }
+    blockCount = initialBlocks.size();
+  }
+
+  // Refine the partitioning until it's stable.
+  while (true) {
+    std::map<std::vector<Int>, Int> signatures;
+    std::vector<Int> newBlocks(stateCount);
+    std::vector<Int> signature(classCount + 1);
+    for (Int state = 0; state < stateCount; ++state) {
+      signature[0] = blocks[state];
+      for (Int charClass = 0; charClass < classCount; ++charClass) {
+        signature[charClass + 1] = blocks[transitions[state * classCount + charClass]];
+      }
+      newBlocks[state] = signatures.emplace(signature, signatures.size()).first->second;
+    }
+    blocks.swap(newBlocks);
+    if (signatures.size() == blockCount) break;
+    blockCount = signatures.size();
+  }
+
+  // Number the blocks, making sure the dead and start states keep their indexes.
+  std::vector<Int> blockStates(blockCount, -1);
+  Int newStateCount = 0;
+  blockStates[blocks[Data::Grammar::LexerDfa::DEAD_STATE]] = newStateCount++;
+  blockStates[blocks[Data::Grammar::LexerDfa::START_STATE]] = newStateCount++;
+  for (Int state = 0; state < stateCount; ++state) {
+    if (blockStates[blocks[state]] == -1) blockStates[blocks[state]] = newStateCount++;
+  }
+
+  // Build the new tables.
+  std::vector<Int> newTransitions(newStateCount * classCount);
+  std::vector<Int> newAcceptedDefIndexes(newStateCount);
+  for (Int state = 0; state < stateCount; ++state) {
+    Int newState = blockStates[blocks[state]];
+    newAcceptedDefIndexes[newState] = acceptedDefIndexes[state];
+    for (Int charClass = 0; charClass < classCount; ++charClass) {
+      newTransitions[newState * classCount + charClass] = blockStates[blocks[transitions[state * classCount + charClass]]];
+    }
+  }
+  transitions.swap(newTransitions);
+  acceptedDefIndexes.swap(newAcceptedDefIndexes);
+}
+
 } // namespace
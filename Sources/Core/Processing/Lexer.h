@@ -13,6 +13,8 @@
 #ifndef CORE_PROCESSING_LEXER_H
 #define CORE_PROCESSING_LEXER_H
 
+#include <map>
+
 namespace Core { namespace Processing
 {
 
@@ -64,12 +66,74 @@ class Lexer : public TiObject
     STOP
   };
 
+  /**
+   * @brief A single interpreter state used while compiling the grammar.
+   *
+   * Each state of the compiled DFA is made of a set of these configurations,
+   * which are snapshots of the LexerState objects that the interpreter would
+   * have had at that point.
+   */
+  private: struct DfaConfig
+  {
+    Int tokenDefIndex;
+    std::vector<LexerState::Level> levels;
+
+    Bool operator<(DfaConfig const &config) const;
+    Bool operator==(DfaConfig const &config) const;
+  };
+
+  private: typedef std::vector<DfaConfig> DfaConfigSet;
+
+  /// The result of applying a character class on a DfaConfig.
+  private: struct DfaConfigStep
+  {
+    Bool computed = false;
+    Bool closed = false;
+    std::vector<Int> nextConfigIndexes;
+  };
+
+  /**
+   * @brief The data needed to compute the unknown entries of an incremental DFA.
+   *
+   * Interpreter configurations are interned and the result of applying a
+   * character class on a configuration is computed once, since the same
+   * configuration is usually part of many DFA states.
+   */
+  private: struct DfaBuildData : public Data::Grammar::LexerDfa::BuildData
+  {
+    std::map<DfaConfig, Int> configIndexes;
+    std::vector<DfaConfig const*> internedConfigs;
+    std::vector<Int> configDefIndexes;
+    std::vector<std::vector<DfaConfigStep>> configSteps;
+    /// The configurations making up each DFA state, along with the reverse index.
+    std::vector<std::vector<Int>> stateConfigs;
+    std::map<std::vector<Int>, Int> stateIndexes;
+  };
+
 
   //============================================================================
   // Member Variables
 
   private: SharedPtr<Data::Grammar::Module> grammarRoot;
 
+  /**
+   * @brief The compiled form of the lexer module.
+   *
+   * This is set at the beginning of each token to the DFA cached in the lexer
+   * module, creating it if needed. If the grammar couldn't be compiled this
+   * will be null and the lexer falls back to interpreting the terms.
+   */
+  private: SharedPtr<Data::Grammar::LexerDfa> dfa;
+
+  /// The current state within the compiled DFA.
+  private: Int dfaState = Data::Grammar::LexerDfa::DEAD_STATE;
+
+  /// The definition index of the best token found so far by the DFA.
+  private: Int dfaTokenDefIndex = -1;
+
+  /// The length of the best token found so far by the DFA, or 0 if none.
+  private: Int dfaTokenLength = 0;
+
   /// The context used to tracer through the grammar.
   private: Data::Grammar::Context grammarContext;
 
@@ -183,6 +247,12 @@ class Lexer : public TiObject
 
   public: void initialize(SharedPtr<Data::Ast::Scope> rootScope);
 
+  /// Prepare for a new parsing operation without releasing allocated states.
+  public: void reset();
+
+  /// Set the grammar context to the lexer module of the grammar root.
+  private: void prepareGrammarContext();
+
   /// Release all data including parsing data and definitions data.
   public: void release()
   {
@@ -203,6 +273,9 @@ class Lexer : public TiObject
   /// Add a string of input characters to the input buffer and process them.
   public: void handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation);
 
+  /// Add a buffer of input characters to the input buffer and process them.
+  public: void handleNewBuffer(Char const *buffer, Word size, Data::SourceLocationRecord &sourceLocation);
+
   /// Process all the characters currently waiting in the input buffer.
   private: void processBuffer();
 
@@ -212,6 +285,15 @@ class Lexer : public TiObject
   /// Process the given input character by updating the states.
   private: Int process();
 
+  /// Accept the token at the start of the input buffer and remove its characters.
+  private: Bool acceptToken(Int tokenDefIndex, Int tokenLength);
+
+  /// Move the first character in the input buffer to the error buffer.
+  private: void rejectChar();
+
+  /// Report pending errors and move to the next character in the input buffer.
+  private: Int finishProcessingChar(Bool closedStateFound, Bool openStateFound);
+
   /// Process the first character in the token.
   private: void processStartChar(WChar inputChar);
 
@@ -231,11 +313,72 @@ class Lexer : public TiObject
   /// Select the best token among the detected tokens.
   private: Int selectBestToken();
 
+  /// Check whether the first token definition is preferred over the second for same length tokens.
+  private: Bool isPreferredTokenDef(Int tokenDefIndex1, Int tokenDefIndex2);
+
   /// Release all states and related data, but not definitions.
   public: void clear();
 
   /// @}
 
+  /// @name Compiled Grammar Functions
+  /// @{
+
+  /// Set the DFA to use for the next token, loading or creating it if needed.
+  private: void prepareDfa();
+
+  /// Process the given input character using the compiled DFA.
+  private: Int processCompiled();
+
+  /// Create a DFA for the given lexer module whose states are expanded on demand.
+  private: SharedPtr<Data::Grammar::LexerDfa> createDfa(Data::Grammar::LexerModule *lexerModule);
+
+  /// Compile the token definitions of the given lexer module into a complete, minimized DFA.
+  private: SharedPtr<Data::Grammar::LexerDfa> compileDfa(Data::Grammar::LexerModule *lexerModule);
+
+  /// Compute and set the unknown accepted token of the given DFA state.
+  private: Int computeDfaAcceptance(Data::Grammar::LexerDfa *dfa, Int state);
+
+  /// Compute and set the unknown transition of the given DFA state by the given character class.
+  private: Int computeDfaTransition(Data::Grammar::LexerDfa *dfa, Int state, Int charClass);
+
+  private: void internDfaConfigs(DfaBuildData *buildData, DfaConfigSet &configs, std::vector<Int> &indexes);
+
+  private: DfaConfigStep const& getDfaConfigStep(
+    DfaBuildData *buildData, std::vector<WChar> const &classStarts, Int configIndex, Int charClass
+  );
+
+  private: void collectDfaBoundaries(
+    Data::Grammar::Term *term, std::vector<WChar> &boundaries, std::vector<Data::Grammar::Term*> &visitedTerms
+  );
+
+  private: void collectDfaBoundaries(Data::Grammar::CharGroupUnit *unit, std::vector<WChar> &boundaries);
+
+  private: Bool stepDfaConfig(DfaConfig const &config, WChar inputChar, DfaConfigSet &nextConfigs);
+
+  private: void addDfaConfig(LexerState *state, DfaConfigSet &configs);
+
+  private: void minimizeDfa(
+    std::vector<Int> &transitions, std::vector<Int> &acceptedDefIndexes, Int classCount
+  );
+
+  /// Compute a hash of everything in the lexer module that affects its compiled DFA.
+  private: LongWord computeDfaGrammarHash(Data::Grammar::LexerModule *lexerModule);
+
+  private: void hashDfaTerm(
+    Data::Grammar::Term *term, LongWord &hash, std::vector<Data::Grammar::Term*> &visitedTerms
+  );
+
+  private: void hashDfaCharGroupUnit(Data::Grammar::CharGroupUnit *unit, LongWord &hash);
+
+  private: static void hashDfaValue(LongWord &hash, LongWord value)
+  {
+    // FNV-1a, applied on the whole value at once.
+    hash = (hash ^ value) * 1099511628211ul;
+  }
+
+  /// @}
+
   /// @name Utility Functions
   /// @{
 
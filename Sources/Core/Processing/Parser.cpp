@@ -50,11 +50,7 @@ void Parser::initialize(SharedPtr<Data::Ast::Scope> rootScope)
   //}
 
   // Lookup parsing dimensions.
-  this->parsingDimensions.clear();
-  for (Int i = 0; i < this->grammarRoot->getCount(); ++i) {
-    Data::Grammar::ParsingDimension *dim = ti_cast<Data::Grammar::ParsingDimension>(this->grammarRoot->getElement(i));
-    if (dim != 0) this->parsingDimensions.push_back(dim);
-  }
+  this->collectParsingDimensions();
 
   // Initialize the tempState used for path testing.
   this->tempState.initialize(
@@ -63,6 +59,31 @@ void Parser::initialize(SharedPtr<Data::Ast::Scope> rootScope)
 }
 
 
+/**
+ * Clears all the data of the previous parsing operation while keeping the
+ * allocated buffers of the temp state. The parsing dimensions are looked up
+ * again since the grammar may have been modified by the previous operation.
+ */
+void Parser::reset()
+{
+  if (this->grammarRoot == 0) {
+    throw EXCEPTION(GenericException, S("Grammar root is not set."));
+  }
+  this->clear();
+  this->collectParsingDimensions();
+}
+
+
+void Parser::collectParsingDimensions()
+{
+  this->parsingDimensions.clear();
+  for (Int i = 0; i < this->grammarRoot->getCount(); ++i) {
+    Data::Grammar::ParsingDimension *dim = ti_cast<Data::Grammar::ParsingDimension>(this->grammarRoot->getElement(i));
+    if (dim != 0) this->parsingDimensions.push_back(dim);
+  }
+}
+
+
 /**
  * Create a state with the main state level then add a level pointing to the
  * program root production (the parsing tree's root). The new state will be
@@ -141,6 +162,8 @@ void Parser::beginParsing()
  */
 SharedPtr<TiObject> Parser::endParsing(Data::SourceLocationRecord &endSourceLocation)
 {
+  TIME_PHASE(PARSING);
+
     // Validation.
   if (this->state == 0) {
     throw EXCEPTION(GenericException, S("Parsing is not initialized yet."));
@@ -163,10 +186,7 @@ SharedPtr<TiObject> Parser::endParsing(Data::SourceLocationRecord &endSourceLoca
         if (!this->getTopParsingHandler(this->state.get())->onErrorToken(this, this->state.get(), 0)) {
           // We don't want to create duplicates of this error message.
           if (!unexpectedEofRaised) {
-            auto sourceLocation = newSrdObj<Data::SourceLocationRecord>();
-            sourceLocation->filename = endSourceLocation.filename;
-            sourceLocation->line = endSourceLocation.line;
-            sourceLocation->column = endSourceLocation.column;
+            auto sourceLocation = newSrdObj<Data::SourceLocationRecord>(endSourceLocation);
             this->state->addNotice(SharedPtr<Notices::Notice>(new Notices::UnexpectedEofNotice(sourceLocation)));
             unexpectedEofRaised = true;
           }
@@ -224,7 +244,6 @@ void Parser::tryCompleteFoldout(ParserState *state)
   if (state->getTermLevelCount() <= 1) return;
   Data::Token token;
   token.setId(this->EOF_TOKEN);
-  this->tempState.reset();
   this->tempState.setBranchingInfo(state, -1);
   this->tempState.setParsingDimensionInfo(
     state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex()
@@ -266,6 +285,8 @@ void Parser::tryCompleteFoldout(ParserState *state)
  */
 void Parser::handleNewToken(Data::Token const *token)
 {
+  TIME_PHASE(PARSING);
+
   // Validation.
   if (token == 0) {
     throw EXCEPTION(InvalidArgumentException, S("token"), S("token is null."));
@@ -827,7 +848,6 @@ Int Parser::determineMultiplyRoute(Data::Token const *token, ParserState *state)
     }
 
     // Initialize the temp state.
-    this->tempState.reset();
     this->tempState.setBranchingInfo(state, -1);
     this->tempState.setParsingDimensionInfo(state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex());
     // Replace the current state level with a new one.
@@ -848,7 +868,6 @@ Int Parser::determineMultiplyRoute(Data::Token const *token, ParserState *state)
     } else {
       if (errorSync) {
         // Test outer route.
-        this->tempState.reset();
         this->tempState.setBranchingInfo(state, -1);
         this->tempState.setParsingDimensionInfo(
           state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex()
@@ -921,7 +940,6 @@ Int Parser::determineAlternateRoute(Data::Token const *token, ParserState *state
   Word termCount = state->getListTermChildCount();
   for (Int i = 0; static_cast<Word>(i) < termCount; i++) {
     // Initialize the temp state branching from the current one.
-    this->tempState.reset();
     this->tempState.setBranchingInfo(state, -1);
     this->tempState.setParsingDimensionInfo(
       state->getParsingDimensionIndex(),
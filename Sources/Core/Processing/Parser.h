@@ -115,6 +115,12 @@ class Parser : public TiObject
 
   public: void initialize(SharedPtr<Data::Ast::Scope> rootScope);
 
+  /// Prepare for a new parsing operation without releasing allocated buffers.
+  public: void reset();
+
+  /// Lookup the parsing dimensions defined in the grammar root.
+  private: void collectParsingDimensions();
+
   public: void release()
   {
     this->clear();
@@ -74,6 +74,15 @@ namespace Core::Processing
  */
 #define LEXER_STATE_LEVEL_MAX_COUNT 64
 
+/**
+ * @brief The maximum number of states in a compiled lexer DFA.
+ * @ingroup core_processing
+ *
+ * Grammars that need more states than this are not compiled and the lexer
+ * falls back to interpreting the token definitions.
+ */
+#define LEXER_DFA_MAX_STATE_COUNT 20000
+
 /**
  * @brief The maximum number of characters in the error buffer.
  * @ingroup core_processing
@@ -231,6 +240,7 @@ s_enum(ParsingFlags,
 #include "InputBuffer.h"
 #include "LexerState.h"
 #include "TokenizingHandler.h"
+#include "GrammarSnapshot.h"
 #include "Lexer.h"
 
 // Parser
@@ -248,6 +258,7 @@ s_enum(ParsingFlags,
 
 // Main Class
 #include "Engine.h"
+#include "EnginePool.h"
 
 // Parsing Handlers
 #include "Handlers/handlers.h"
@@ -17,6 +17,8 @@
 #include <vector>
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
 #include <utility>
 #include <string>
 #include <iostream>
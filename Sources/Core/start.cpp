@@ -40,6 +40,23 @@ Str getSystemLanguage()
 }
 
 
+/**
+ * @brief Output the collected time report, if enabled.
+ * @ingroup main
+ * The report is printed as a table if requested, and written in JSON format
+ * if a filename is given.
+ */
+void outputTimeReport(Bool print, Char const *jsonFilename)
+{
+  auto timeReport = Basic::TimeReport::getSingleton();
+  if (!timeReport->isEnabled()) return;
+  if (print) timeReport->print(outStream);
+  if (jsonFilename != 0 && !timeReport->writeJson(jsonFilename)) {
+    outStream << S("Could not write the time report to: ") << jsonFilename << NEW_LINE;
+  }
+}
+
+
 /**
  * @brief The entry point of the program.
  * @ingroup main
@@ -52,6 +69,10 @@ int main(int argCount, char * const args[])
   Bool interactive = false;
   Char const *sourceFile = 0;
   Bool dump = false;
+  Bool jitCache = false;
+  Int jitThreads = -1;
+  Bool timeReport = false;
+  Char const *timeReportJson = 0;
   if (argCount < 2) help = true;
   for (Int i = 1; i < argCount; ++i) {
     if (strcmp(args[i], S("--help")) == 0) help = true;
@@ -62,6 +83,24 @@ int main(int argCount, char * const args[])
     else if (strcmp(args[i], S("-ت")) == 0) interactive = true;
     else if (strcmp(args[i], S("--dump")) == 0) dump = true;
     else if (strcmp(args[i], S("--إلقاء")) == 0) dump = true;
+    else if (strcmp(args[i], S("--jit-cache")) == 0) jitCache = true;
+    else if (strcmp(args[i], S("--خبيئة")) == 0) jitCache = true;
+    // Parse the JIT compile threads option.
+    else if (strcmp(args[i], S("--jit-threads")) == 0 || strcmp(args[i], S("--خيوط-الترجمة")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        jitThreads = atoi(args[i]);
+      }
+    }
+    else if (strcmp(args[i], S("--time-report")) == 0) timeReport = true;
+    else if (strcmp(args[i], S("--تقرير-الزمن")) == 0) timeReport = true;
+    // Parse the JSON time report option.
+    else if (strcmp(args[i], S("--time-report-json")) == 0 || strcmp(args[i], S("--تقرير-الزمن-json")) == 0) {
+      if (i < argCount-1) {
+        ++i;
+        timeReportJson = args[i];
+      }
+    }
 #ifdef USE_LOGS
     // Parse the log option.
     else if (strcmp(args[i], S("--log")) == 0 || strcmp(args[i], S("--تدوين")) == 0) {
@@ -85,6 +124,8 @@ int main(int argCount, char * const args[])
     Core::Notices::L18nDictionary::getSingleton()->initialize(lang);
   }
 
+  if (timeReport || timeReportJson != 0) Basic::TimeReport::getSingleton()->setEnabled(true);
+
   // We'll show help if now source file is given.
   if (sourceFile == 0 && !interactive) help = true;
 
@@ -118,6 +159,18 @@ int main(int argCount, char * const args[])
       outStream << S("\tالقاء شجرة AST عند الانتهاء:\n");
       outStream << S("\t\t--شجرة\n");
       outStream << S("\t\t--dump\n");
+      outStream << S("\tتفعيل خبيئة الشفرة المترجمة آنيًا:\n");
+      outStream << S("\t\t--خبيئة\n");
+      outStream << S("\t\t--jit-cache\n");
+      outStream << S("\tعدد خيوط الترجمة الآنية (الافتراضي عدد أنوية المعالج):\n");
+      outStream << S("\t\t--خيوط-الترجمة\n");
+      outStream << S("\t\t--jit-threads\n");
+      outStream << S("\tطباعة تقرير بالزمن المستغرق في كل مرحلة عند الانتهاء:\n");
+      outStream << S("\t\t--تقرير-الزمن\n");
+      outStream << S("\t\t--time-report\n");
+      outStream << S("\tكتابة تقرير الزمن بصيغة JSON في الملف المعطى:\n");
+      outStream << S("\t\t--تقرير-الزمن-json\n");
+      outStream << S("\t\t--time-report-json\n");
       #if defined(USE_LOGS)
         outStream << S("\tالتحكم بمستوى التدوين (قيمة من 6 بتات):\n");
         outStream << S("\t\t--تدوين\n");
@@ -138,6 +191,10 @@ int main(int argCount, char * const args[])
       outStream << S("\nOptions:\n");
       outStream << S("\t--interactive, -i  Run in interactive mode.\n");
       outStream << S("\t--dump  Tells the Core to dump the resulting AST tree.\n");
+      outStream << S("\t--jit-cache  Enable the on-disk cache of JIT compiled code.\n");
+      outStream << S("\t--jit-threads  The number of JIT compile threads. Defaults to the number of CPU cores.\n");
+      outStream << S("\t--time-report  Print the time spent in each build phase when done.\n");
+      outStream << S("\t--time-report-json  Write the time report in JSON format to the given file.\n");
       #if defined(USE_LOGS)
         outStream << S("\t--log  A 6 bit value to control the level of details of the log.\n");
       #endif
@@ -154,9 +211,13 @@ int main(int argCount, char * const args[])
     }
 
     try {
+      finally([=] { outputTimeReport(timeReport, timeReportJson); });
+
       // Prepare the root object;
       Main::RootManager root;
       root.setInteractive(true);
+      root.setJitCacheEnabled(jitCache);
+      root.setJitThreadCount(jitThreads);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
@@ -180,8 +241,12 @@ int main(int argCount, char * const args[])
   } else {
     // Parse the provided source file.
     try {
+      finally([=] { outputTimeReport(timeReport, timeReportJson); });
+
       // Prepare the root object;
       Main::RootManager root;
+      root.setJitCacheEnabled(jitCache);
+      root.setJitThreadCount(jitThreads);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang);
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
@@ -61,6 +61,12 @@ void CalleeTracer::_lookupCallee(TiObject *self, CalleeLookupRequest &request, C
 {
   PREPARE_SELF(tracer, CalleeTracer);
 
+  // Lookups that start with a populated result depend on that result, so they can't be cached.
+  CacheKey cacheKey;
+  Bool cacheable = result.isNew() && result.stack.getLength() == 0 && CalleeTracer::prepareCacheKey(request, cacheKey);
+  if (cacheable && tracer->findCachedResult(cacheKey, result)) return;
+  Word generation = Core::Data::Ast::getDefinitionsGeneration();
+
   if (request.ref != 0) {
     auto target = request.target;
     Int tracingAlias = 0;
@@ -264,6 +270,9 @@ void CalleeTracer::_lookupCallee(TiObject *self, CalleeLookupRequest &request, C
     if (result.notice != 0) result.notice->setSourceLocation(Core::Data::Ast::findSourceLocation(
       request.ref != 0 ? request.ref : request.astNode
     ));
+  } else if (cacheable && generation == Core::Data::Ast::getDefinitionsGeneration()) {
+    // Only cache the result if no definitions changed during the lookup.
+    tracer->cacheResult(cacheKey, result);
   }
 }
 
@@ -800,6 +809,105 @@ void CalleeTracer::_lookupCallee_builtInOp(TiObject *self, CalleeLookupRequest &
 }
 
 
+//==============================================================================
+// Cache Functions
+
+Word CalleeTracer::CacheKeyHasher::operator()(CacheKey const &key) const
+{
+  Word hash = std::hash<TiObject*>()(key.target.get());
+  auto combine = [&hash](Word value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+  combine(std::hash<Str>()(key.ref));
+  combine(key.hasRef);
+  combine(key.mode);
+  combine(key.skipInjections);
+  combine(std::hash<Str>()(key.varTargetOp));
+  combine(std::hash<Str>()(key.op));
+  combine(std::hash<TiObject*>()(key.thisType.get()));
+  for (auto const &argType : key.argTypes) combine(std::hash<TiObject*>()(argType.get()));
+  return hash;
+}
+
+
+Bool CalleeTracer::isCacheEnabled()
+{
+  static Bool enabled = isEnvFlagEnabled(S("ALUSUS_CALLEE_CACHE"), true);
+  return enabled;
+}
+
+
+/**
+ * Prepare the cache key of the given lookup request. Only requests that look
+ * up plain identifiers, or that don't look up any identifier, that don't
+ * include template params, and whose target and types are owned by shared
+ * pointers can be cached.
+ *
+ * @return Returns true if the request can be cached, false otherwise.
+ */
+Bool CalleeTracer::prepareCacheKey(CalleeLookupRequest const &request, CacheKey &key)
+{
+  if (!CalleeTracer::isCacheEnabled()) return false;
+  if (request.templateParam != 0) return false;
+  if (request.ref != 0) {
+    auto identifier = ti_cast<Core::Data::Ast::Identifier>(request.ref);
+    if (identifier == 0) return false;
+    key.ref = identifier->getValue().get();
+    key.hasRef = true;
+  } else {
+    key.hasRef = false;
+  }
+  // Hold the objects so they stay alive, and keep their addresses unique, while they are in the cache.
+  auto hold = [](TiObject *obj, TioSharedPtr &ptr)->Bool {
+    if (obj == 0) return true;
+    ptr = getSharedPtr(obj);
+    return ptr != 0;
+  };
+  if (!hold(request.target, key.target)) return false;
+  key.mode = request.mode.val;
+  key.skipInjections = request.skipInjections;
+  if (request.varTargetOp != 0) key.varTargetOp = request.varTargetOp;
+  key.op = request.op;
+  if (!hold(request.thisType, key.thisType)) return false;
+  if (request.argTypes != 0) {
+    key.argTypes.resize(request.argTypes->getElementCount());
+    for (Int i = 0; i < request.argTypes->getElementCount(); ++i) {
+      if (!hold(request.argTypes->getElement(i), key.argTypes[i])) return false;
+    }
+  }
+  return true;
+}
+
+
+Bool CalleeTracer::findCachedResult(CacheKey const &key, CalleeLookupResult &result)
+{
+  // Drop the cache if any definition has changed since the results were cached.
+  Word generation = Core::Data::Ast::getDefinitionsGeneration();
+  if (this->cacheGeneration != generation) {
+    this->cache.clear();
+    this->cacheGeneration = generation;
+  }
+
+  auto iter = this->cache.find(key);
+  if (iter == this->cache.end()) {
+    TIME_REPORT_COUNT(CALLEE_CACHE_MISSES, 1);
+    return false;
+  }
+  TIME_REPORT_COUNT(CALLEE_CACHE_HITS, 1);
+  result.matchStatus = iter->second.matchStatus;
+  result.stack = iter->second.stack;
+  result.injectionLevel = iter->second.injectionLevel;
+  return true;
+}
+
+
+void CalleeTracer::cacheResult(CacheKey const &key, CalleeLookupResult const &result)
+{
+  if (this->cacheGeneration != Core::Data::Ast::getDefinitionsGeneration()) return;
+  this->cache[key] = { result.matchStatus, result.stack, result.injectionLevel };
+}
+
+
 //==============================================================================
 // Helper Functions
 
@@ -16,6 +16,21 @@
 namespace Spp::Ast
 {
 
+/**
+ * @brief Looks up the callees of expressions.
+ * @ingroup spp_ast
+ *
+ * Successful lookups are memoized in a cache keyed by the lookup target, the
+ * identifier being looked up, the operation, the lookup mode, and the types of
+ * the arguments. The key holds shared pointers to the target and the types so
+ * that they can't be freed and their addresses reused while they are cached,
+ * and lookups involving objects that aren't owned by shared pointers aren't
+ * cached. The cache is dropped whenever definitions change in any scope (see
+ * Core::Data::Ast::getDefinitionsGeneration). Failed lookups are never cached
+ * so that their notices are always raised the same way. Hits and misses are
+ * counted in the time report. The cache can be disabled by setting the
+ * ALUSUS_CALLEE_CACHE environment variable to 0.
+ */
 class CalleeTracer : public TiObject, public DynamicBinding, public DynamicInterfacing
 {
   //============================================================================
@@ -27,11 +42,51 @@ class CalleeTracer : public TiObject, public DynamicBinding, public DynamicInter
   ));
 
 
+  //============================================================================
+  // Types
+
+  private: struct CacheKey
+  {
+    TioSharedPtr target;
+    Str ref;
+    Bool hasRef;
+    Int mode;
+    Bool skipInjections;
+    Str varTargetOp;
+    Str op;
+    TioSharedPtr thisType;
+    std::vector<TioSharedPtr> argTypes;
+
+    Bool operator==(CacheKey const &key) const
+    {
+      return this->target == key.target && this->hasRef == key.hasRef && this->ref == key.ref &&
+        this->mode == key.mode && this->skipInjections == key.skipInjections &&
+        this->varTargetOp == key.varTargetOp && this->op == key.op && this->thisType == key.thisType &&
+        this->argTypes == key.argTypes;
+    }
+  };
+
+  private: struct CacheKeyHasher
+  {
+    Word operator()(CacheKey const &key) const;
+  };
+
+  private: struct CacheEntry
+  {
+    TypeMatchStatus matchStatus;
+    Array<CalleeLookupResultStackEntry> stack;
+    Int injectionLevel;
+  };
+
+
   //============================================================================
   // Member Variables
 
   private: Helper *helper;
 
+  private: std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher> cache;
+  private: Word cacheGeneration = 0;
+
 
   //============================================================================
   // Implementations
@@ -85,6 +140,26 @@ class CalleeTracer : public TiObject, public DynamicBinding, public DynamicInter
 
   /// @}
 
+  /// @name Cache Functions
+  /// @{
+
+  /// Check whether lookup results are cached.
+  public: static Bool isCacheEnabled();
+
+  /// Drop all cached lookup results.
+  public: void clearCache()
+  {
+    this->cache.clear();
+  }
+
+  private: static Bool prepareCacheKey(CalleeLookupRequest const &request, CacheKey &key);
+
+  private: Bool findCachedResult(CacheKey const &key, CalleeLookupResult &result);
+
+  private: void cacheResult(CacheKey const &key, CalleeLookupResult const &result);
+
+  /// @}
+
   /// @name Main Functions
   /// @{
 
@@ -92,6 +92,34 @@ void Helper::initBindings()
 }
 
 
+void Helper::clearInternedTypes()
+{
+  this->intTypes.clear();
+  this->wordTypes.clear();
+  this->floatTypes.clear();
+  this->charArrayTypes.clear();
+  this->pointerTypes.clear();
+  for (auto &types : this->referenceTypes) types.clear();
+}
+
+
+/**
+ * Pointer and reference types are interned by the identity of their content
+ * type, which is only valid for types that live in the AST for the lifetime of
+ * the build. Type references need to be traced in their own context, and
+ * function types can be created on the fly and are matched structurally, so
+ * neither is interned.
+ *
+ * @return Returns the given object as a Type if it can be used as an interning
+ *         key, 0 otherwise.
+ */
+Type* Helper::getInternableType(TiObject *type)
+{
+  if (type == 0 || !type->isDerivedFrom<Type>() || type->isDerivedFrom<FunctionType>()) return 0;
+  return static_cast<Type*>(type);
+}
+
+
 //==============================================================================
 // Main Functions
 
@@ -405,6 +433,13 @@ ReferenceType* Helper::_getReferenceTypeFor(TiObject *self, TiObject *type, Refe
 {
   PREPARE_SELF(helper, Helper);
 
+  auto internableType = Helper::getInternableType(type);
+  auto &interned = helper->referenceTypes[mode.get()];
+  if (internableType != 0) {
+    auto it = interned.find(internableType);
+    if (it != interned.end()) return it->second;
+  }
+
   auto tpl = helper->getReferenceTemplate(mode);
 
   TioSharedPtr result;
@@ -413,6 +448,7 @@ ReferenceType* Helper::_getReferenceTypeFor(TiObject *self, TiObject *type, Refe
     if (refType == 0) {
       throw EXCEPTION(GenericException, S("Template for reference type is invalid."));
     }
+    if (internableType != 0) interned[internableType] = refType;
     return refType;
   } else {
     auto notice = result.ti_cast<Core::Notices::Notice>();
@@ -438,6 +474,12 @@ PointerType* Helper::_getPointerTypeFor(TiObject *self, TiObject *type)
 {
   PREPARE_SELF(helper, Helper);
 
+  auto internableType = Helper::getInternableType(type);
+  if (internableType != 0) {
+    auto it = helper->pointerTypes.find(internableType);
+    if (it != helper->pointerTypes.end()) return it->second;
+  }
+
   auto tpl = helper->getPointerTemplate();
 
   TioSharedPtr result;
@@ -446,6 +488,7 @@ PointerType* Helper::_getPointerTypeFor(TiObject *self, TiObject *type)
     if (refType == 0) {
       throw EXCEPTION(GenericException, S("Template for pointer type is invalid."));
     }
+    if (internableType != 0) helper->pointerTypes[internableType] = refType;
     return refType;
   } else {
     auto notice = result.ti_cast<Core::Notices::Notice>();
@@ -574,6 +617,9 @@ ArrayType* Helper::_getCharArrayType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
 
+  auto it = helper->charArrayTypes.find(size);
+  if (it != helper->charArrayTypes.end()) return it->second;
+
   // Prepare the reference.
   if (helper->charArrayTypeRef == 0) {
     // Create a new reference.
@@ -599,6 +645,7 @@ ArrayType* Helper::_getCharArrayType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get char array AST type."));
   }
+  helper->charArrayTypes[size] = astType;
   return astType;
 }
 
@@ -616,6 +663,10 @@ IntegerType* Helper::_getArchIntType(TiObject *self)
 IntegerType* Helper::_getIntType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+
+  auto it = helper->intTypes.find(size);
+  if (it != helper->intTypes.end()) return it->second;
+
   // Prepare the reference.
   if (helper->integerTypeRef == 0) {
     // Create a new reference.
@@ -639,6 +690,7 @@ IntegerType* Helper::_getIntType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get integer AST type."));
   }
+  helper->intTypes[size] = astType;
   return astType;
 }
 
@@ -656,6 +708,10 @@ IntegerType* Helper::_getWord64Type(TiObject *self)
 IntegerType* Helper::_getWordType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+
+  auto it = helper->wordTypes.find(size);
+  if (it != helper->wordTypes.end()) return it->second;
+
   // Prepare the reference.
   if (helper->wordTypeRef == 0) {
     // Create a new reference.
@@ -679,6 +735,7 @@ IntegerType* Helper::_getWordType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get integer AST type."));
   }
+  helper->wordTypes[size] = astType;
   return astType;
 }
 
@@ -686,6 +743,10 @@ IntegerType* Helper::_getWordType(TiObject *self, Word size)
 FloatType* Helper::_getFloatType(TiObject *self, Word size)
 {
   PREPARE_SELF(helper, Helper);
+
+  auto it = helper->floatTypes.find(size);
+  if (it != helper->floatTypes.end()) return it->second;
+
   // Prepare the reference.
   if (helper->floatTypeRef == 0) {
     // Create a new reference.
@@ -709,6 +770,7 @@ FloatType* Helper::_getFloatType(TiObject *self, Word size)
   if (astType == 0) {
     throw EXCEPTION(GenericException, S("Failed to get float AST type."));
   }
+  helper->floatTypes[size] = astType;
   return astType;
 }
 
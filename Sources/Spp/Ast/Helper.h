@@ -51,6 +51,18 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   private: SharedPtr<Core::Data::Ast::ParamPass> floatTypeRef;
   private: SharedPtr<Core::Data::Ast::ParamPass> charArrayTypeRef;
 
+  /// @name Interned Types
+  /// Built-in types looked up so far, keyed by bit width, array size, or
+  /// content type. These are filled lazily and reset by prepare().
+  /// @{
+  private: std::unordered_map<Word, IntegerType*> intTypes;
+  private: std::unordered_map<Word, IntegerType*> wordTypes;
+  private: std::unordered_map<Word, FloatType*> floatTypes;
+  private: std::unordered_map<Word, ArrayType*> charArrayTypes;
+  private: std::unordered_map<Type*, PointerType*> pointerTypes;
+  private: std::unordered_map<Type*, ReferenceType*> referenceTypes[4];
+  /// @}
+
 
   //============================================================================
   // Implementations
@@ -91,8 +103,13 @@ class Helper : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: void prepare()
   {
     this->refTemplate = 0;
+    this->clearInternedTypes();
   }
 
+  private: void clearInternedTypes();
+
+  private: static Type* getInternableType(TiObject *type);
+
   /// @}
 
   /// @name Property Getters
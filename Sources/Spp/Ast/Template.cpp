@@ -54,18 +54,35 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
     return false;
   }
 
-  // Do we already have an instance?
-  auto count = this->instances.getCount();
-  for (Int i = 0; i < count; ++i) {
-    if (this->matchTemplateVars(&vars, this->instances.getElement(i), helper, notice)) {
-      result = this->instances.get(i)->get(0);
-      return true;
-    } else {
-      if (notice != 0) {
+  // Do we already have an instance? Instances with hashable vars are looked up through the index, and only
+  // instances sharing the same hash are matched structurally. Matching vars always hash identically, so any
+  // existing instance for these vars is guaranteed to be in the index.
+  Word hash;
+  Bool indexed = Template::isInstanceIndexEnabled() && this->hashTemplateVars(&vars, hash);
+  if (indexed) {
+    auto range = this->instanceIndex.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (this->matchTemplateVars(&vars, this->instances.getElement(it->second), helper, notice)) {
+        result = this->instances.get(it->second)->get(0);
+        return true;
+      } else if (notice != 0) {
         result = notice;
         return false;
       }
     }
+  } else {
+    auto count = this->instances.getCount();
+    for (Int i = 0; i < count; ++i) {
+      if (this->matchTemplateVars(&vars, this->instances.getElement(i), helper, notice)) {
+        result = this->instances.get(i)->get(0);
+        return true;
+      } else {
+        if (notice != 0) {
+          result = notice;
+          return false;
+        }
+      }
+    }
   }
 
   // No instance was found, create a new one.
@@ -78,6 +95,8 @@ Bool Template::matchInstance(TiObject *templateInputs, Helper *helper, TioShared
   }
   this->instances.add(block);
   block->setOwner(this);
+  TIME_REPORT_COUNT(TEMPLATE_INSTANCES, 1);
+  if (indexed) this->instanceIndex.emplace(hash, this->instances.getCount() - 1);
   result = this->instances.get(this->instances.getCount() - 1)->get(0);
   return true;
 }
@@ -123,6 +142,63 @@ Bool Template::prepareTemplateVars(
 }
 
 
+/**
+ * Compute a hash of the given traced template vars that is consistent with
+ * matchTemplateVar, i.e. vars that match always have the same hash. Integers
+ * and strings are hashed by value while other vars are hashed by identity.
+ * Function types and AST vars are matched structurally and have no cheap
+ * canonical form, so they are not hashed.
+ *
+ * @return Returns true if the hash was computed, false if any of the vars
+ *         can't be hashed, in which case instances need to be looked up by
+ *         matching the vars against each instance.
+ */
+Bool Template::hashTemplateVars(Containing<TiObject> *templateInputs, Word &hash)
+{
+  // Templates without vars have a single, default instance that isn't indexed.
+  if (this->getVarDefCount() == 0) return false;
+
+  hash = 0;
+  auto combine = [&hash](Word value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+  for (Int i = 0; i < this->getVarDefCount(); ++i) {
+    auto varDef = this->varDefs->get(i).s_cast_get<TemplateVarDef>();
+    ASSERT(varDef != 0);
+    auto var = templateInputs->getElement(i);
+    ASSERT(var != 0);
+    switch (varDef->getType().get()) {
+      case TemplateVarType::INTEGER: {
+        auto literal = static_cast<Core::Data::Ast::IntegerLiteral*>(var);
+        combine(std::hash<LongInt>()(std::stol(literal->getValue().get())));
+        break;
+      }
+
+      case TemplateVarType::STRING: {
+        auto literal = static_cast<Core::Data::Ast::StringLiteral*>(var);
+        combine(std::hash<std::string_view>()(literal->getValue().get()));
+        break;
+      }
+
+      case TemplateVarType::TYPE:
+        if (var->isA<Spp::Ast::FunctionType>()) return false;
+        combine(std::hash<TiObject*>()(var));
+        break;
+
+      case TemplateVarType::MODULE:
+      case TemplateVarType::FUNCTION:
+      case TemplateVarType::AST_REF:
+        combine(std::hash<TiObject*>()(var));
+        break;
+
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+
 Bool Template::matchTemplateVars(
   Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
   SharedPtr<Core::Notices::Notice> &notice
@@ -244,6 +320,13 @@ Bool Template::assignTemplateVars(
 }
 
 
+Bool Template::isInstanceIndexEnabled()
+{
+  static Bool enabled = isEnvFlagEnabled(S("ALUSUS_TEMPLATE_INDEX"), true);
+  return enabled;
+}
+
+
 TiObject* Template::getTemplateVar(Core::Data::Ast::Scope const *instance, Char const *name)
 {
   for (Int i = 0; i < instance->getCount(); ++i) {
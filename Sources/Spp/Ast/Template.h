@@ -40,6 +40,9 @@ class Template : public Core::Data::Node,
 
   private: SharedList<Core::Data::Ast::Scope> instances;
 
+  /// Maps the hash of an instance's template vars to the instance's index.
+  private: std::unordered_multimap<Word, Word> instanceIndex;
+
 
   //============================================================================
   // Implementations
@@ -116,6 +119,8 @@ class Template : public Core::Data::Node,
     TiObject *templateInputs, Helper *helper, PlainList<TiObject> *vars, SharedPtr<Core::Notices::Notice> &notice
   );
 
+  private: Bool hashTemplateVars(Containing<TiObject> *templateInputs, Word &hash);
+
   private: Bool matchTemplateVars(
     Containing<TiObject> *templateInputs, Core::Data::Ast::Scope *instance, Helper *helper,
     SharedPtr<Core::Notices::Notice> &notice
@@ -130,6 +135,8 @@ class Template : public Core::Data::Node,
     SharedPtr<Core::Notices::Notice> &notice
   );
 
+  public: static Bool isInstanceIndexEnabled();
+
   public: static TiObject* getTemplateVar(Core::Data::Ast::Scope const *instance, Char const *name);
 
   private: static TiObject* traceObject(TiObject *ref, TemplateVarType varType, Helper *helper);
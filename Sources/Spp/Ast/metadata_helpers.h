@@ -24,13 +24,21 @@ constexpr Char const* META_EXTRA_AST_TYPE = S("astType");
 //==============================================================================
 // Global Functions
 
+// getAstTypeExtraSlot
+
+inline Word getAstTypeExtraSlot()
+{
+  static Word slot = Core::Data::Ast::MetaHaving::getExtraSlot(META_EXTRA_AST_TYPE);
+  return slot;
+}
+
 // tryGetAstType
 
 template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
 inline Type* tryGetAstType(OT *object)
 {
-  auto box = object->getExtra(META_EXTRA_AST_TYPE).template ti_cast_get<TiBox<Type*>>();
+  auto box = object->getExtra(getAstTypeExtraSlot()).template ti_cast_get<TiBox<Type*>>();
   if (box == 0) return 0;
   else return box->get();
 }
@@ -41,7 +49,7 @@ inline Type* tryGetAstType(OT *object)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) return 0;
-  auto box = metadata->getExtra(META_EXTRA_AST_TYPE).template ti_cast_get<TiBox<Type*>>();
+  auto box = metadata->getExtra(getAstTypeExtraSlot()).template ti_cast_get<TiBox<Type*>>();
   if (box == 0) return 0;
   else return box->get();
 }
@@ -64,7 +72,7 @@ template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
 inline void setAstType(OT *object, SharedPtr<Type> const &type)
 {
-  object->setExtra(META_EXTRA_AST_TYPE, TiBox<Type*>::create(type.get()));
+  object->setExtra(getAstTypeExtraSlot(), TiBox<Type*>::create(type.get()));
 }
 
 template <class OT,
@@ -75,14 +83,14 @@ inline void setAstType(OT *object, SharedPtr<Type> const &type)
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(META_EXTRA_AST_TYPE, TiBox<Type*>::create(type.get()));
+  metadata->setExtra(getAstTypeExtraSlot(), TiBox<Type*>::create(type.get()));
 }
 
 template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
 inline void setAstType(OT *object, Type *type)
 {
-  object->setExtra(META_EXTRA_AST_TYPE, TiBox<Type*>::create(type));
+  object->setExtra(getAstTypeExtraSlot(), TiBox<Type*>::create(type));
 }
 
 template <class OT,
@@ -93,7 +101,7 @@ inline void setAstType(OT *object, Type *type)
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(META_EXTRA_AST_TYPE, TiBox<Type*>::create(type));
+  metadata->setExtra(getAstTypeExtraSlot(), TiBox<Type*>::create(type));
 }
 
 } // namespace
@@ -74,18 +74,27 @@ void BuildManager::initNonOfflineBuildSessions()
 {
   // Prepare build targets and target generators.
 
+  Int compileThreadCount = this->rootManager->getJitThreadCount();
+  if (compileThreadCount < 0) compileThreadCount = LlvmCodeGen::JitEngine::getDefaultCompileThreadCount();
+
   auto jitBuildTarget = newSrdObj<LlvmCodeGen::JitBuildTarget>(this->globalItemRepo);
+  jitBuildTarget->setObjectCacheEnabled(this->rootManager->isJitCacheEnabled());
+  jitBuildTarget->setCompileThreadCount(compileThreadCount);
   auto jitTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     this->rootManager, jitBuildTarget.get(), false
   );
   jitTargetGenerator->setupBuild();
 
   auto preprocessBuildTarget = newSrdObj<LlvmCodeGen::LazyJitBuildTarget>(this->globalItemRepo);
+  preprocessBuildTarget->setCompileThreadCount(compileThreadCount);
   auto preprocessTargetGenerator = newSrdObj<LlvmCodeGen::TargetGenerator>(
     jitTargetGenerator.get(), preprocessBuildTarget.get(), true
   );
   preprocessTargetGenerator->setupBuild();
 
+  // Functions compiled for preprocessing are linked into the JIT program rather than compiled again.
+  jitBuildTarget->setSharedCodeSource(preprocessBuildTarget.get());
+
   // Prepare sessions.
 
   this->preprocessBuildSession = newSrdObj<BuildSession>(
@@ -95,6 +104,9 @@ void BuildManager::initNonOfflineBuildSessions()
     (BuildSession*)0
   );
   this->preprocessBuildSession->getExtraDataAccessor()->setIdPrefix("preprc", "jit");
+  if (BuildManager::isCodeSharingEnabled()) {
+    this->preprocessBuildSession->getCodeGenSession()->setCodeSharing(true);
+  }
 
   this->jitBuildSession = newSrdObj<BuildSession>(
     ++this->buildIdCounter, BuildManager::BuildType::JIT, false, jitTargetGenerator, jitBuildTarget,
@@ -269,6 +281,11 @@ Bool BuildManager::_execute(TiObject *self, BuildSession *buildSession)
   if (ctorBuildSession == 0) ctorBuildSession = buildSession;
 
   if ((minSeverity == -1 || minSeverity > 1) && (thisMinSeverity == -1 || thisMinSeverity > 1)) {
+    Core::Basic::TimeReport::Scope timeReportScope(
+      buildSession->getBuildType() == BuildType::PREPROCESS ?
+        Core::Basic::TimeReport::Phase::PREPROCESSING : Core::Basic::TimeReport::Phase::EXECUTION
+    );
+
     // Execute constructors.
     if (ctorBuildSession->getBuildType() == BuildType::JIT) {
       for (Int index = 0; index < buildSession->getGlobalCtors()->getLength(); ++index) {
@@ -344,12 +361,26 @@ void BuildManager::_dumpLlvmIrForElement(TiObject *self, TiObject *element)
 
 
 Bool BuildManager::_buildObjectFileForElement(
-  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Int optimizationLevel, Char const *cpu, Char const *features, Word partitionCount
 ) {
   VALIDATE_NOT_NULL(element);
   PREPARE_SELF(buildMgr, BuildManager);
 
+  // Validate the options before preparing the build, otherwise the build would be left without being reset.
+  if (!LlvmCodeGen::OfflineBuildTarget::isValidOptimizationLevel(optimizationLevel)) {
+    buildMgr->rootManager->getNoticeStore()->add(
+      newSrdObj<Spp::Notices::InvalidOptimizationLevelNotice>(Core::Data::Ast::findSourceLocation(element))
+    );
+    buildMgr->rootManager->flushNotices();
+    return false;
+  }
+
   SharedPtr<BuildSession> buildSession = buildMgr->prepareBuild(BuildManager::BuildType::OFFLINE, targetTriple);
+  auto buildTarget = buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>();
+  buildTarget->setOptimizationLevel(optimizationLevel);
+  buildTarget->setCpu(cpu, features);
+  buildTarget->setPartitionCount(partitionCount);
   Bool result = true;
   if (element->isDerivedFrom<Ast::Module>()) {
     buildMgr->prepareExecutionEntry(buildSession.get());
@@ -362,9 +393,7 @@ Bool BuildManager::_buildObjectFileForElement(
   if (result) {
     Array<Str> globalCtorNames = BuildManager::getGlobalCtorNames(buildSession.get());
     Array<Str> globalDtorNames = BuildManager::getGlobalDtorNames(buildSession.get());
-    buildSession->getBuildTarget().s_cast<LlvmCodeGen::OfflineBuildTarget>()->generateObjectFile(
-      objectFilename, &globalCtorNames, &globalDtorNames
-    );
+    buildTarget->generateObjectFile(objectFilename, &globalCtorNames, &globalDtorNames);
   }
 
   buildMgr->resetBuild(buildSession.get());
@@ -400,6 +429,7 @@ void BuildManager::_resetBuildData(TiObject *self, TiObject *obj, CodeGen::Extra
     eda->removeAutoCtorType(metahaving);
     eda->removeAutoDtor(metahaving);
     eda->removeAutoDtorType(metahaving);
+    eda->removeCodeHash(metahaving);
     eda->resetCodeGenFailed(metahaving);
     eda->resetInitStatementsGenIndex(metahaving);
   }
@@ -482,4 +512,11 @@ Array<Str> BuildManager::getGlobalDtorNames(BuildSession *buildSession)
   return globalDtorNames;
 }
 
+
+Bool BuildManager::isCodeSharingEnabled()
+{
+  static Bool enabled = isEnvFlagEnabled(S("ALUSUS_SHARED_CODE"), true);
+  return enabled;
+}
+
 } // namespace
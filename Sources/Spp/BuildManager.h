@@ -149,9 +149,15 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
   public: METHOD_BINDING_CACHE(dumpLlvmIrForElement, void, (TiObject*));
   public: static void _dumpLlvmIrForElement(TiObject *self, TiObject *element);
 
-  public: METHOD_BINDING_CACHE(buildObjectFileForElement, Bool, (TiObject*, Char const*, Char const*));
+  public: METHOD_BINDING_CACHE(buildObjectFileForElement,
+    Bool, (
+      TiObject* /* element */, Char const* /* objectFilename */, Char const* /* targetTriple */,
+      Int /* optimizationLevel */, Char const* /* cpu */, Char const* /* features */, Word /* partitionCount */
+    )
+  );
   public: static Bool _buildObjectFileForElement(
-    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Int optimizationLevel, Char const *cpu, Char const *features, Word partitionCount
   );
 
   public: METHOD_BINDING_CACHE(resetBuild, void, (BuildSession*));
@@ -174,6 +180,13 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   private: static Array<Str> getGlobalDtorNames(BuildSession *buildSession);
 
+  /**
+   * @brief Check whether the JIT session can link to code generated by the preprocess session.
+   * Sharing can be disabled by setting the ALUSUS_SHARED_CODE environment
+   * variable to 0.
+   */
+  private: static Bool isCodeSharingEnabled();
+
   /// @}
 
 }; // class
@@ -106,6 +106,7 @@ class BuildSession : public TiObject
       bs->getGlobalCtorSession() == 0 ? 0 : bs->getGlobalCtorSession()->getCodeGenSession()
     )
   {
+    this->codeGenSession.setCodeSharing(bs->getCodeGenSession()->isCodeSharing());
   }
 
 
@@ -71,6 +71,8 @@ Bool AstProcessor::_process(TiObject *self, TiObject *owner)
 {
   PREPARE_SELF(astProcessor, AstProcessor);
   VALIDATE_NOT_NULL(owner);
+  TIME_PHASE(AST_PROCESSING);
+  TIME_REPORT_COUNT(AST_NODES, 1);
 
   if (owner == 0 || owner->isDerivedFrom<Core::Data::Grammar::Module>()) return true;
 
@@ -21,6 +21,9 @@ struct DependencyInfo
   public: DependencyList<Core::Data::Node> globalVarInitializationDeps;
   public: DependencyList<Core::Data::Node> globalVarDestructionDeps;
   public: DependencyList<Ast::Function> funcDeps;
+
+  /// Whether the generated code refers to functions, global variables, or user types.
+  public: Bool hasExternalRefs = false;
 };
 
 } // namespace
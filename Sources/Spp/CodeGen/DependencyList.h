@@ -16,30 +16,69 @@
 namespace Spp { namespace CodeGen
 {
 
-template<class CTYPE> class DependencyList : public PlainList<CTYPE>
+/**
+ * @brief A queue of AST elements that need to be generated.
+ * @ingroup spp_codegen
+ *
+ * Elements are kept in a deque to allow constant time insertion at either end
+ * and removal from the front, while a hash set of the queued elements allows
+ * duplicates to be rejected in constant time. An element can be queued again
+ * after it's removed from the list.
+ */
+template<class CTYPE> class DependencyList
 {
   //============================================================================
-  // Constructor & Destructor
+  // Member Variables
 
-  public: using PlainList<CTYPE>::PlainList;
+  private: std::deque<CTYPE*> items;
+  private: std::unordered_set<CTYPE*> index;
 
 
   //============================================================================
   // Member Functions
 
+  /// Queue the given element unless it's already queued.
   public: void add(CTYPE *f, Bool highPriority)
   {
-    if (this->find(f) != -1) return;
-    if (highPriority) PlainList<CTYPE>::insert(0, f);
-    else PlainList<CTYPE>::add(f);
+    if (!this->index.insert(f).second) return;
+    if (highPriority) this->items.push_front(f);
+    else this->items.push_back(f);
+  }
+
+  public: Bool contains(CTYPE *f) const
+  {
+    return this->index.find(f) != this->index.end();
+  }
+
+  public: CTYPE* get(Int i) const
+  {
+    return this->items[i];
+  }
+
+  public: Word getCount() const
+  {
+    return this->items.size();
+  }
+
+  /// Remove and return the element at the front of the queue.
+  public: CTYPE* takeFirst()
+  {
+    auto f = this->items.front();
+    this->items.pop_front();
+    this->index.erase(f);
+    return f;
+  }
+
+  public: void remove(Int i)
+  {
+    this->index.erase(this->items[i]);
+    this->items.erase(this->items.begin() + i);
   }
 
-  public: Int find(CTYPE *f) const
+  public: void clear()
   {
-    for (Int i = 0; i < this->getCount(); ++i) {
-      if (this->get(i) == f) return i;
-    }
-    return -1;
+    this->items.clear();
+    this->index.clear();
   }
 
 }; // class
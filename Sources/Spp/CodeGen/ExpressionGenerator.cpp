@@ -2527,6 +2527,7 @@ Bool ExpressionGenerator::_generateVarReference(
       }
     } else if (expGenerator->getAstHelper()->getVariableDomain(varDef) == Ast::DefinitionDomain::GLOBAL) {
       // This is a global variable. Let's make sure it's generated, and generate it if not.
+      session->getDependencyInfo()->hasExternalRefs = true;
       if (!g->generateVarDef(varDef, session)) return false;
       tgVar = session->getEda()->getCodeGenData<TiObject>(varAstNode);
     } else {
@@ -3247,6 +3248,9 @@ Bool ExpressionGenerator::castLogicalOperand(
 }
 
 Bool ExpressionGenerator::addFunctionDependencyIfNeeded(Session *session, Spp::Ast::Function *func) {
+  // The callee can be overloaded or redefined without the caller changing, so the caller's code can't be shared.
+  session->getDependencyInfo()->hasExternalRefs = true;
+
   auto body = func->getBody().get();
 
   // If the function has no body (i.e. it's external or intrinsic), we don't need to add it as a dependency.
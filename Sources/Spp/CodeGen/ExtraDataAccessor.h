@@ -30,6 +30,15 @@
 namespace Spp::CodeGen
 {
 
+/**
+ * @brief Accessor of the data attached to AST nodes by a build session.
+ * @ingroup spp_codegen
+ *
+ * Each build session stores its data in separate extras by prefixing the
+ * extra names with a session specific prefix. The names are resolved into
+ * extra slot ids once when the prefix is set, so accessing the data doesn't
+ * involve any name lookups.
+ */
 class ExtraDataAccessor : public TiObject
 {
   //============================================================================
@@ -41,15 +50,16 @@ class ExtraDataAccessor : public TiObject
   //============================================================================
   // Member Variables
 
-  private: Str idCodeGenData;
-  private: Str idAutoCtor;
-  private: Str idAutoCtorType;
-  private: Str idAutoDtor;
-  private: Str idAutoDtorType;
-  private: Str idCodeGenFailed;
-  private: Str idInitStatementGenIndex;
-  private: Str idBuildId;
-  private: Str idGlobalVarState;
+  private: Word idCodeGenData;
+  private: Word idAutoCtor;
+  private: Word idAutoCtorType;
+  private: Word idAutoDtor;
+  private: Word idAutoDtorType;
+  private: Word idCodeGenFailed;
+  private: Word idInitStatementGenIndex;
+  private: Word idCodeHash;
+  private: Word idBuildId;
+  private: Word idGlobalVarState;
 
 
   //============================================================================
@@ -68,16 +78,17 @@ class ExtraDataAccessor : public TiObject
   {
     Str idPrefix = prefix;
     Str sharedIdPrefix = sharedPrefix != 0 ? Str(sharedPrefix) : idPrefix;
-    this->idCodeGenData = idPrefix + S("codeGenData");
-    this->idAutoCtor = idPrefix + S("autoCtor");
-    this->idAutoCtorType = idPrefix + S("autoCtorType");
-    this->idAutoDtor = idPrefix + S("autoDtor");
-    this->idAutoDtorType = idPrefix + S("autoDtorType");
-    this->idCodeGenFailed = idPrefix + S("codeGenFailed");
-    this->idInitStatementGenIndex = idPrefix + S("initStatementGenIndex");
-
-    this->idBuildId = sharedIdPrefix + S("buildId");
-    this->idGlobalVarState = sharedIdPrefix + S("globalVarState");
+    this->idCodeGenData = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("codeGenData"));
+    this->idAutoCtor = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("autoCtor"));
+    this->idAutoCtorType = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("autoCtorType"));
+    this->idAutoDtor = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("autoDtor"));
+    this->idAutoDtorType = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("autoDtorType"));
+    this->idCodeGenFailed = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("codeGenFailed"));
+    this->idInitStatementGenIndex = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("initStatementGenIndex"));
+    this->idCodeHash = Core::Data::Ast::MetaHaving::getExtraSlot(idPrefix + S("codeHash"));
+
+    this->idBuildId = Core::Data::Ast::MetaHaving::getExtraSlot(sharedIdPrefix + S("buildId"));
+    this->idGlobalVarState = Core::Data::Ast::MetaHaving::getExtraSlot(sharedIdPrefix + S("globalVarState"));
   }
 
   DEFINE_EXTRA_ACCESSORS(CodeGenData);
@@ -85,6 +96,7 @@ class ExtraDataAccessor : public TiObject
   DEFINE_EXTRA_ACCESSORS(AutoCtorType);
   DEFINE_EXTRA_ACCESSORS(AutoDtor);
   DEFINE_EXTRA_ACCESSORS(AutoDtorType);
+  DEFINE_EXTRA_ACCESSORS(CodeHash);
   DEFINE_EXTRA_ACCESSORS(BuildId);
   DEFINE_EXTRA_ACCESSORS(GlobalVarState);
 
@@ -127,6 +127,8 @@ Bool Generator::_generateModuleInit(TiObject *self, Spp::Ast::Module *astModule,
 Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, Session *session)
 {
   PREPARE_SELF(generator, Generator);
+  TIME_PHASE(CODE_GENERATION);
+  TIME_REPORT_COUNT(FUNCTIONS, 1);
   auto generation = ti_cast<Generation>(generator);
 
   auto tgFunc = session->getEda()->tryGetCodeGenData<TiObject>(astFunc);
@@ -137,6 +139,8 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
 
   auto astBlock = astFunc->getBody().get();
   if (astBlock != 0 && session->getEda()->tryGetCodeGenData<TiObject>(astBlock) == 0) {
+    if (generator->linkSharedFunction(astFunc, tgFunc, session)) return true;
+
     LOG(
       Spp::LogLevel::CODEGEN, S("Generating function body: ") << generator->astHelper->getFunctionName(astFunc)
     );
@@ -258,6 +262,12 @@ Bool Generator::_generateFunction(TiObject *self, Spp::Ast::Function *astFunc, S
 
     session->getEda()->removeBuildId(astFunc);
 
+    // Remember the state of the function's AST so that other sessions can link to the code generated by this
+    // session. See linkSharedFunction.
+    if (retVal && session->isCodeSharing() && generator->isLeafFunction(astFunc, dependencyInfo.get())) {
+      session->getEda()->setCodeHash(astFunc, TiWord::create(Core::Data::Ast::computeHash(astFunc)));
+    }
+
     return retVal;
   }
   return true;
@@ -1159,8 +1169,7 @@ Bool Generator::_buildDependencies(TiObject *self, Session *session)
 
   // Build function dependencies.
   while (session->getFuncDeps()->getCount() > 0) {
-    auto astFunc = static_cast<Ast::Function*>(session->getFuncDeps()->get(0));
-    session->getFuncDeps()->remove(0);
+    auto astFunc = session->getFuncDeps()->takeFirst();
     if (!generation->generateFunction(astFunc, session)) result = false;
   }
 
@@ -1446,4 +1455,67 @@ Str Generator::getGlobalVarMangledName(Core::Data::Node *astVar)
   return name;
 }
 
+
+/**
+ * A function is a leaf if its code doesn't refer to other functions, global
+ * variables, or user types. The code of such a function depends only on its own
+ * AST, whereas the code of other functions also depends on how the names they
+ * refer to are resolved, which can change (by overloading a callee for example)
+ * without changing their AST.
+ */
+Bool Generator::isLeafFunction(Spp::Ast::Function *astFunc, DependencyInfo *depsInfo)
+{
+  if (depsInfo->hasExternalRefs) return false;
+
+  auto astFuncType = astFunc->getType().get();
+  auto astArgs = astFuncType->getArgTypes().get();
+  if (astArgs != 0) {
+    for (Int i = 0; i < astArgs->getElementCount(); ++i) {
+      auto argType = astArgs->getElement(i);
+      if (argType->isDerivedFrom<Ast::ArgPack>()) return false;
+      if (this->typeGenerator->isUserTypeBased(Ast::getAstType(argType))) return false;
+    }
+  }
+  return !this->typeGenerator->isUserTypeBased(astFuncType->traceRetType(this->astHelper));
+}
+
+
+/**
+ * Functions used at preprocess time are usually needed at run time as well, so
+ * rather than generating and compiling them again the JIT session declares
+ * them and links the declarations to the code already compiled by the
+ * preprocess session, which is the JIT session's global ctor session. This is
+ * only done for leaf functions (see isLeafFunction) whose AST didn't change
+ * since the preprocess session generated them, which is detected by comparing
+ * the AST's hash with the hash recorded at the end of that generation. The
+ * linked code is compiled lazily, function by function, so JIT code calling
+ * it can't inline it, which matters little for leaf functions.
+ *
+ * @return Returns true if the function got linked, false if its body needs to
+ *         be generated by the given session.
+ */
+Bool Generator::linkSharedFunction(Spp::Ast::Function *astFunc, TiObject *tgFunc, Session *session)
+{
+  auto sharedSession = session->getGlobalCtorSession();
+  if (sharedSession == 0 || sharedSession == session || !sharedSession->isCodeSharing()) return false;
+
+  auto codeHash = sharedSession->getEda()->tryGetCodeHash<TiWord>(astFunc);
+  if (codeHash == 0 || sharedSession->getEda()->didCodeGenFail(astFunc)) return false;
+  if (codeHash->get() != Core::Data::Ast::computeHash(astFunc)) {
+    LOG(
+      Spp::LogLevel::CODEGEN,
+      S("Function modified after preprocessing: ") << this->astHelper->getFunctionName(astFunc)
+    );
+    return false;
+  }
+
+  if (!session->getTg()->linkSharedFunction(tgFunc)) return false;
+  LOG(Spp::LogLevel::CODEGEN, S("Linking shared function: ") << this->astHelper->getFunctionName(astFunc));
+  TIME_REPORT_COUNT(SHARED_FUNCTIONS, 1);
+
+  // Mark the body as generated so it doesn't get queued again for generation in this session.
+  session->getEda()->setCodeGenData(astFunc->getBody().get(), getSharedPtr(tgFunc));
+  return true;
+}
+
 } // namespace
@@ -276,6 +276,10 @@ class Generator : public TiObject, public DynamicBinding, public DynamicInterfac
 
   private: Str getGlobalVarMangledName(Core::Data::Node *astVar);
 
+  private: Bool isLeafFunction(Spp::Ast::Function *astFunc, DependencyInfo *depsInfo);
+
+  private: Bool linkSharedFunction(Spp::Ast::Function *astFunc, TiObject *tgFunc, Session *session);
+
   /// @}
 
 }; // class
@@ -39,7 +39,7 @@ class GlobalItemRepo
   //============================================================================
   // Constructor
 
-  public: GlobalItemRepo() : map(true)
+  public: GlobalItemRepo() : map(MapIndexType::HASHED)
   {
   }
 
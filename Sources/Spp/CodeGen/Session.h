@@ -52,6 +52,9 @@ class Session : public TiObject
   // slower).
   private: Session *globalCtorSession;
 
+  // Whether other sessions link to the code generated by this session rather than generating their own.
+  private: Bool codeSharing = false;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -89,6 +92,7 @@ class Session : public TiObject
     , tgSelf(session->getTgSelf())
     , astSelfType(session->getAstSelfType())
     , globalCtorSession(session->getGlobalCtorSession())
+    , codeSharing(session->isCodeSharing())
   {}
 
   public: Session(
@@ -106,6 +110,7 @@ class Session : public TiObject
     , tgSelf(session->getTgSelf())
     , astSelfType(session->getAstSelfType())
     , globalCtorSession(session->getGlobalCtorSession())
+    , codeSharing(session->isCodeSharing())
   {}
 
   public: Session(
@@ -124,6 +129,7 @@ class Session : public TiObject
     , globalCtors(session->getGlobalCtors())
     , globalDtors(session->getGlobalDtors())
     , globalCtorSession(session->getGlobalCtorSession())
+    , codeSharing(session->isCodeSharing())
   {}
 
 
@@ -210,6 +216,14 @@ class Session : public TiObject
     return this->globalCtorSession;
   }
 
+  public: void setCodeSharing(Bool cs) {
+    this->codeSharing = cs;
+  }
+
+  public: Bool isCodeSharing() const {
+    return this->codeSharing;
+  }
+
 }; // class
 
 } // namespace
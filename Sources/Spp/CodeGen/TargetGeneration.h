@@ -50,6 +50,7 @@ class TargetGeneration : public ObjTiInterface
       &this->prepareFunctionBody,
       &this->finishFunctionBody,
       &this->deleteFunction,
+      &this->linkSharedFunction,
       &this->generateGlobalVariable,
       &this->generateLocalVariable,
       &this->prepareIfStatement,
@@ -210,6 +211,8 @@ class TargetGeneration : public ObjTiInterface
 
   public: METHOD_BINDING_CACHE(deleteFunction, Bool, (TiObject* /* function */));
 
+  public: METHOD_BINDING_CACHE(linkSharedFunction, Bool, (TiObject* /* function */));
+
   /// @}
 
   /// @name Variable Definition Generation Functions
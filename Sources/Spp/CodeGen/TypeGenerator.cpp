@@ -151,6 +151,23 @@ Bool TypeGenerator::getGeneratedTypeAutoDtor(
 }
 
 
+Bool TypeGenerator::isUserTypeBased(Spp::Ast::Type *astType)
+{
+  while (astType != 0) {
+    if (astType->isDerivedFrom<Spp::Ast::PointerType>()) {
+      astType = static_cast<Spp::Ast::PointerType*>(astType)->getContentType(this->astHelper);
+    } else if (astType->isDerivedFrom<Spp::Ast::ReferenceType>()) {
+      astType = static_cast<Spp::Ast::ReferenceType*>(astType)->getContentType(this->astHelper);
+    } else if (astType->isDerivedFrom<Spp::Ast::ArrayType>()) {
+      astType = static_cast<Spp::Ast::ArrayType*>(astType)->getContentType(this->astHelper);
+    } else {
+      return astType->isDerivedFrom<Spp::Ast::UserType>() || astType->isDerivedFrom<Spp::Ast::FunctionType>();
+    }
+  }
+  return false;
+}
+
+
 //==============================================================================
 // Code Generation Functions
 
@@ -158,6 +175,11 @@ Bool TypeGenerator::_generateType(TiObject *self, Spp::Ast::Type *astType, Gener
 {
   PREPARE_SELF(typeGenerator, TypeGenerator);
 
+  // Code that depends on the layout of user types can't be shared with other sessions since the types can change.
+  if (session->isCodeSharing() && typeGenerator->isUserTypeBased(astType)) {
+    session->getDependencyInfo()->hasExternalRefs = true;
+  }
+
   auto cgType = session->getEda()->tryGetCodeGenData<TiObject>(astType);
   if (cgType != 0) return true;
 
@@ -110,6 +110,9 @@ class TypeGenerator : public TiObject, public DynamicBinding, public DynamicInte
     Spp::Ast::Type *astType, Generation *g, Session *session, TiObject *&tgAutoCtor
   );
 
+  /// Check whether the given type is a user type, a function type, or is built on one.
+  public: Bool isUserTypeBased(Spp::Ast::Type *astType);
+
   /// @}
 
   /// @name Code Generation Functions
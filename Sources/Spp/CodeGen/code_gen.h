@@ -57,26 +57,26 @@ s_enum(GlobalVarState,
 
 template <class DT, class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline DT* tryGetExtra(OT *object, Char const *name)
+inline DT* tryGetExtra(OT *object, Word slot)
 {
-  return object->getExtra(name).template ti_cast_get<DT>();
+  return object->getExtra(slot).template ti_cast_get<DT>();
 }
 
 template <class DT, class OT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline DT* tryGetExtra(OT *object, Char const *name)
+inline DT* tryGetExtra(OT *object, Word slot)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) return 0;
-  return metadata->getExtra(name).template ti_cast_get<DT>();
+  return metadata->getExtra(slot).template ti_cast_get<DT>();
 }
 
 // getExtra
 
 template <class DT, class OT>
-inline DT* getExtra(OT *object, Char const *name)
+inline DT* getExtra(OT *object, Word slot)
 {
-  auto result = tryGetExtra<DT, OT>(object, name);
+  auto result = tryGetExtra<DT, OT>(object, slot);
   if (result == 0) {
     throw EXCEPTION(GenericException, S("Object is missing the generated data."));
   }
@@ -87,72 +87,80 @@ inline DT* getExtra(OT *object, Char const *name)
 
 template <class DT, class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void setExtra(OT *object, Char const *name, SharedPtr<DT> const &data)
+inline void setExtra(OT *object, Word slot, SharedPtr<DT> const &data)
 {
-  object->setExtra(name, data);
+  object->setExtra(slot, data);
 }
 
 template <class DT, class OT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void setExtra(OT *object, Char const *name, SharedPtr<DT> const &data)
+inline void setExtra(OT *object, Word slot, SharedPtr<DT> const &data)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(name, data);
+  metadata->setExtra(slot, data);
 }
 
 // removeExtra
 
 template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void removeExtra(OT *object, Char const *name)
+inline void removeExtra(OT *object, Word slot)
 {
-  object->removeExtra(name);
+  object->removeExtra(slot);
 }
 
 template <class OT,
           typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
-inline void removeExtra(OT *object, Char const *name)
+inline void removeExtra(OT *object, Word slot)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->removeExtra(name);
+  metadata->removeExtra(slot);
 }
 
 // Ast Related Accessors
 
+#define DEFINE_EXTRA_SLOT(name) \
+  inline Word get##name##ExtraSlot() { \
+    static Word slot = Core::Data::Ast::MetaHaving::getExtraSlot(#name); return slot; \
+  }
+
 #define DEFINE_FLAG_ACCESSORS(name) \
+  DEFINE_EXTRA_SLOT(name) \
   template <class OT> inline Bool is##name(OT *object) { \
-    auto f = tryGetExtra<TiBool>(object, #name); return f && f->get(); \
+    auto f = tryGetExtra<TiBool>(object, get##name##ExtraSlot()); return f && f->get(); \
   } \
   template <class OT> inline void set##name(OT *object, Bool f) { \
-    setExtra(object, #name, TiBool::create(f)); \
+    setExtra(object, get##name##ExtraSlot(), TiBool::create(f)); \
   } \
-  template <class OT> inline void reset##name(OT *object) { removeExtra(object, #name); }
+  template <class OT> inline void reset##name(OT *object) { removeExtra(object, get##name##ExtraSlot()); }
 
 #define DEFINE_STR_ACCESSORS(name) \
+  DEFINE_EXTRA_SLOT(name) \
   template <class OT> inline void set##name(OT *object, Str f) { \
-    setExtra(object, #name, TiStr::create(f)); \
+    setExtra(object, get##name##ExtraSlot(), TiStr::create(f)); \
   } \
   template <class OT> inline Str get##name(OT *object) { \
-    auto s = tryGetExtra<TiStr>(object, #name); return s != 0 ? s->getStr() : Str(); \
+    auto s = tryGetExtra<TiStr>(object, get##name##ExtraSlot()); return s != 0 ? s->getStr() : Str(); \
   } \
-  template <class OT> inline void reset##name(OT *object) { removeExtra(object, #name); }
+  template <class OT> inline void reset##name(OT *object) { removeExtra(object, get##name##ExtraSlot()); }
 
 DEFINE_FLAG_ACCESSORS(Executed);
 DEFINE_STR_ACCESSORS(MangledName);
 
 // Ast Processing State
+DEFINE_EXTRA_SLOT(AstProcessing);
 template <class OT> inline Int getAstProcessingState(OT *object) {
-  auto f = tryGetExtra<TiInt>(object, "AstProcessing");
+  auto f = tryGetExtra<TiInt>(object, getAstProcessingExtraSlot());
   return f ? f->get() : AstProcessingState::NOT_STARTED;
 }
 template <class OT> inline void setAstProcessingState(OT *object, Int s) {
-  setExtra(object, "AstProcessing", TiInt::create(s));
+  setExtra(object, getAstProcessingExtraSlot(), TiInt::create(s));
 }
 
 } // namespace
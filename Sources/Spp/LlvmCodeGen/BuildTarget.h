@@ -50,6 +50,18 @@ class BuildTarget : public TiObject
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module) = 0;
 
+  /**
+   * @brief Link the given declared function to code compiled by another target.
+   * The function will be resolved from the shared code source of this target
+   * instead of being compiled again.
+   * @return Returns false if the target doesn't share code with other targets,
+   *         in which case the function needs to be compiled by this target.
+   */
+  public: virtual Bool linkSharedFunction(Char const *name)
+  {
+    return false;
+  }
+
   public: virtual llvm::Type* getVaListType();
 
 }; // class
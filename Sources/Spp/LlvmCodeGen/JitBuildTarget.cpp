@@ -20,8 +20,20 @@ void JitBuildTarget::setupBuild()
   BuildTarget::setupBuild();
 
   this->llvmJitEngine.reset();
-
-  this->llvmJitEngine = llvm::cantFail(JitEngineBuilder().create(this->globalItemRepo));
+  {
+    std::lock_guard<std::mutex> lock(this->sharedFunctionsMutex);
+    this->sharedFunctions.clear();
+  }
+  // Nothing links to the shared code anymore.
+  if (this->sharedCodeSource != 0) this->sharedCodeSource->releaseSharedCode();
+
+  this->llvmJitEngine = llvm::cantFail(
+    JitEngineBuilder()
+      .setNumCompileThreads(this->compileThreadCount)
+      .setUseObjectCache(this->objectCacheEnabled)
+      .setSharedSymbolLookup([this](llvm::StringRef name) { return this->lookupSharedFunction(name); })
+      .create(this->globalItemRepo)
+  );
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -66,13 +78,50 @@ void JitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 }
 
 
+/**
+ * The function is resolved against the engine that is current at the time of
+ * linking, which the shared code source keeps alive until this target is reset
+ * even if the source itself gets reset in the meantime.
+ */
+Bool JitBuildTarget::linkSharedFunction(Char const *name)
+{
+  if (this->sharedCodeSource == 0) return false;
+  auto engine = this->sharedCodeSource->shareEngine();
+  std::lock_guard<std::mutex> lock(this->sharedFunctionsMutex);
+  this->sharedFunctions[name] = engine;
+  return true;
+}
+
+
+/**
+ * This is called by the JIT engine while linking compiled modules, which can
+ * happen on the compile threads.
+ */
+llvm::JITTargetAddress JitBuildTarget::lookupSharedFunction(llvm::StringRef name)
+{
+  LazyJitEngine *engine;
+  {
+    std::lock_guard<std::mutex> lock(this->sharedFunctionsMutex);
+    auto iter = this->sharedFunctions.find(name.str());
+    if (iter == this->sharedFunctions.end()) return 0;
+    engine = iter->second;
+  }
+  return LazyJitBuildTarget::lookupFunction(engine, name);
+}
+
+
 void JitBuildTarget::execute(Char const *entry)
 {
   if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
 
   typedef void (*FuncType)();
-  auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
-  auto funcPtr = (FuncType)llvmEntry.getAddress();
+  FuncType funcPtr;
+  {
+    // Looking up the entry is what triggers compiling the added modules.
+    TIME_PHASE(CODE_EMISSION);
+    auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
+    funcPtr = (FuncType)llvmEntry.getAddress();
+  }
 
   funcPtr();
 }
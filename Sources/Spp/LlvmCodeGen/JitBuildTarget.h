@@ -13,9 +13,13 @@
 #ifndef SPP_LLVMCODEGEN_JITBUILDTARGET_H
 #define SPP_LLVMCODEGEN_JITBUILDTARGET_H
 
+#include <mutex>
+
 namespace Spp::LlvmCodeGen
 {
 
+class LazyJitBuildTarget;
+
 class JitBuildTarget : public BuildTarget
 {
   //============================================================================
@@ -35,6 +39,19 @@ class JitBuildTarget : public BuildTarget
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
 
+  /// Whether to cache compiled objects on disk to speed up subsequent runs.
+  private: Bool objectCacheEnabled = false;
+
+  /// The number of threads used to optimize and compile modules, 0 to compile on the calling thread.
+  private: Word compileThreadCount = 0;
+
+  /// The target whose compiled functions can be linked by this target instead of compiling them again.
+  private: LazyJitBuildTarget *sharedCodeSource = 0;
+
+  /// The functions linked from the shared code source, mapped to the engines that compiled them.
+  private: std::unordered_map<std::string, LazyJitEngine*> sharedFunctions;
+  private: std::mutex sharedFunctionsMutex;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -54,6 +71,36 @@ class JitBuildTarget : public BuildTarget
   //============================================================================
   // Member Functions
 
+  public: void setObjectCacheEnabled(Bool e)
+  {
+    this->objectCacheEnabled = e;
+  }
+
+  public: Bool isObjectCacheEnabled() const
+  {
+    return this->objectCacheEnabled;
+  }
+
+  public: void setCompileThreadCount(Word c)
+  {
+    this->compileThreadCount = c;
+  }
+
+  public: Word getCompileThreadCount() const
+  {
+    return this->compileThreadCount;
+  }
+
+  public: void setSharedCodeSource(LazyJitBuildTarget *source)
+  {
+    this->sharedCodeSource = source;
+  }
+
+  public: LazyJitBuildTarget* getSharedCodeSource() const
+  {
+    return this->sharedCodeSource;
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -75,6 +122,11 @@ class JitBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  public: virtual Bool linkSharedFunction(Char const *name);
+
+  /// Get the address of the given function if it's linked from the shared code source, 0 otherwise.
+  private: llvm::JITTargetAddress lookupSharedFunction(llvm::StringRef name);
+
   public: void execute(Char const *entry);
 
 }; // class
@@ -0,0 +1,193 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp::LlvmCodeGen
+{
+
+/// An output stream that feeds everything written to it into a SHA1 hash.
+class HashingOStream : public llvm::raw_ostream
+{
+  public: llvm::SHA1 hasher;
+
+  public: HashingOStream()
+  {
+    this->SetUnbuffered();
+  }
+
+  private: virtual void write_impl(char const *ptr, size_t size) override
+  {
+    this->hasher.update(llvm::ArrayRef<uint8_t>(reinterpret_cast<uint8_t const*>(ptr), size));
+    this->pos += size;
+  }
+
+  private: virtual uint64_t current_pos() const override
+  {
+    return this->pos;
+  }
+
+  private: uint64_t pos = 0;
+};
+
+
+/// A compile function that stores the objects it compiles in a JitObjectCache.
+class CachingCompiler : public llvm::orc::IRCompileLayer::IRCompiler
+{
+  private: std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> compiler;
+  private: JitObjectCache *cache;
+
+  public: CachingCompiler(std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> c, JitObjectCache *cache) :
+    IRCompiler(c->getManglingOptions()), compiler(std::move(c)), cache(cache)
+  {
+  }
+
+  public: virtual llvm::Expected<std::unique_ptr<llvm::MemoryBuffer>> operator()(llvm::Module &module) override
+  {
+    // The compiler modifies the module during code generation, so the key must
+    // be known before compiling.
+    std::string key = JitObjectCache::getModuleKey(module);
+    if (key.empty()) {
+      key = this->cache->computeKey(module);
+      auto buffer = this->cache->load(key);
+      if (buffer != 0) return std::move(buffer);
+    }
+    auto obj = (*this->compiler)(module);
+    if (obj) this->cache->store(key, (*obj)->getMemBufferRef());
+    return obj;
+  }
+};
+
+
+//==============================================================================
+// Initialization
+
+Bool JitObjectCache::isEnabled(Bool requested)
+{
+  return isEnvFlagEnabled(S("ALUSUS_JIT_CACHE"), requested);
+}
+
+
+std::unique_ptr<JitObjectCache> JitObjectCache::create(
+  llvm::orc::JITTargetMachineBuilder const &jtmb, Bool optimized
+) {
+  llvm::SmallString<256> dir;
+  Char const *customDir = getenv(S("ALUSUS_JIT_CACHE_DIR"));
+  if (customDir != 0 && getStrLen(customDir) > 0) {
+    dir = customDir;
+  } else {
+    if (!llvm::sys::path::cache_directory(dir)) return 0;
+    llvm::sys::path::append(dir, S("alusus"), S("jit"));
+  }
+  if (llvm::sys::fs::create_directories(dir)) return 0;
+
+  // Keep the cache within its size limit. This is only needed once per process.
+  static std::once_flag pruneFlag;
+  std::call_once(pruneFlag, [&dir] {
+    llvm::CachePruningPolicy policy;
+    Char const *maxSize = getenv(S("ALUSUS_JIT_CACHE_SIZE"));
+    LongInt maxSizeMb = maxSize == 0 ? 0 : atol(maxSize);
+    if (maxSizeMb <= 0) maxSizeMb = JIT_CACHE_DEFAULT_MAX_SIZE;
+    policy.MaxSizeBytes = maxSizeMb * 1024 * 1024;
+    llvm::pruneCache(dir, policy);
+  });
+
+  std::string config;
+  llvm::raw_string_ostream configStream(config);
+  configStream << LLVM_VERSION_STRING << S("|") << jtmb.getTargetTriple().str() << S("|") << jtmb.getCPU()
+    << S("|") << jtmb.getFeatures().getString() << S("|") << (optimized ? S("O3") : S("O0"));
+  configStream.flush();
+
+  return std::unique_ptr<JitObjectCache>(new JitObjectCache(dir.str().str(), config));
+}
+
+
+//==============================================================================
+// Member Functions
+
+std::string JitObjectCache::computeKey(llvm::Module const &module)
+{
+  HashingOStream stream;
+  stream << this->configKey;
+  module.print(stream, 0);
+  stream.flush();
+  auto hash = stream.hasher.final();
+  return std::string(S("llvmcache-")) + llvm::toHex(llvm::StringRef((Char const*)hash.data(), hash.size()), true);
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::lookup(llvm::Module &module)
+{
+  std::string key = this->computeKey(module);
+  auto buffer = this->load(key);
+  if (buffer == 0) module.setModuleIdentifier(key);
+  return buffer;
+}
+
+
+std::string JitObjectCache::getModuleKey(llvm::Module const &module)
+{
+  auto &id = module.getModuleIdentifier();
+  if (llvm::StringRef(id).startswith(S("llvmcache-"))) return id;
+  return std::string();
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::load(std::string const &key)
+{
+  auto buffer = llvm::MemoryBuffer::getFile(this->getFilePath(key));
+  if (!buffer) {
+    ++this->missCount;
+    return 0;
+  }
+  ++this->hitCount;
+  TIME_REPORT_COUNT(JIT_CACHE_HITS, 1);
+  return std::move(*buffer);
+}
+
+
+void JitObjectCache::store(std::string const &key, llvm::MemoryBufferRef obj)
+{
+  // Write into a temporary file first then rename it so that other processes
+  // never see a partially written object.
+  Int fd;
+  llvm::SmallString<256> tempPath;
+  if (llvm::sys::fs::createUniqueFile(this->getFilePath(key) + S("-%%%%%%.tmp"), fd, tempPath)) return;
+  {
+    llvm::raw_fd_ostream out(fd, true);
+    out << obj.getBuffer();
+    out.close();
+    if (out.has_error()) {
+      out.clear_error();
+      llvm::sys::fs::remove(tempPath);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(tempPath, this->getFilePath(key))) llvm::sys::fs::remove(tempPath);
+}
+
+
+std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> JitObjectCache::createCompiler(
+  std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> compiler
+) {
+  return std::make_unique<CachingCompiler>(std::move(compiler), this);
+}
+
+
+std::string JitObjectCache::getFilePath(std::string const &key) const
+{
+  llvm::SmallString<256> path(this->cacheDir);
+  llvm::sys::path::append(path, key);
+  return path.str().str();
+}
+
+} // namespace
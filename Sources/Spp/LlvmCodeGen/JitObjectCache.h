@@ -0,0 +1,133 @@
+/**
+ * @file Spp/LlvmCodeGen/JitObjectCache.h
+ * Contains the header of class Spp::LlvmCodeGen::JitObjectCache.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+#define SPP_LLVMCODEGEN_JITOBJECTCACHE_H
+
+#include <mutex>
+
+/// The default maximum size, in megabytes, of the JIT object cache.
+#define JIT_CACHE_DEFAULT_MAX_SIZE 256
+
+namespace Spp::LlvmCodeGen
+{
+
+/**
+ * @brief An on-disk cache of objects compiled by the JIT engines.
+ * @ingroup spp_llvmcodegen
+ *
+ * Objects are keyed by a hash of the module's IR combined with the target
+ * triple, CPU, features, and the optimization flag of the engine, so a cached
+ * object is only reused when the compiler would have produced the exact same
+ * output. The cache directory is pruned to a maximum size once per process.
+ *
+ * Modules are looked up when added to the engine, before they are optimized.
+ * On a miss the key is kept as the module's identifier, which is preserved when
+ * the module is optimized or cloned into a new context, and the object is
+ * stored under it by the compile function created by createCompiler. Modules
+ * that reach the compile function without a key, like the partitions of lazily
+ * compiled modules, are looked up there instead.
+ *
+ * The cache is disabled by default. It's enabled by the --jit-cache command
+ * line option, and can be configured using the following environment
+ * variables:
+ *   ALUSUS_JIT_CACHE: Set to 1 to enable the cache or 0 to disable it,
+ *                     regardless of the command line.
+ *   ALUSUS_JIT_CACHE_DIR: The cache directory. Defaults to alusus/jit within
+ *                         the user's cache directory.
+ *   ALUSUS_JIT_CACHE_SIZE: The maximum size of the cache in megabytes.
+ */
+class JitObjectCache
+{
+  //============================================================================
+  // Member Variables
+
+  private: std::string cacheDir;
+
+  /// A string identifying the target and compilation options, hashed with the IR.
+  private: std::string configKey;
+
+  private: std::atomic<Word> hitCount;
+  private: std::atomic<Word> missCount;
+
+
+  //============================================================================
+  // Constructor
+
+  private: JitObjectCache(std::string const &dir, std::string const &config) :
+    cacheDir(dir), configKey(config), hitCount(0), missCount(0)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Check whether the cache should be used.
+   * The environment overrides the given value, which is the setting requested
+   * by the command line.
+   */
+  public: static Bool isEnabled(Bool requested);
+
+  /**
+   * @brief Create a cache for the given target machine.
+   * Returns null if the cache directory could not be created.
+   */
+  public: static std::unique_ptr<JitObjectCache> create(
+    llvm::orc::JITTargetMachineBuilder const &jtmb, Bool optimized
+  );
+
+  /// Compute the cache key of the given module.
+  public: std::string computeKey(llvm::Module const &module);
+
+  /**
+   * @brief Look up the object of the given module.
+   * On a miss the module is tagged with its key so that its object gets
+   * stored once compiled. Returns null if not cached.
+   */
+  public: std::unique_ptr<llvm::MemoryBuffer> lookup(llvm::Module &module);
+
+  /// Returns the key the given module was tagged with by lookup, or an empty string.
+  public: static std::string getModuleKey(llvm::Module const &module);
+
+  /// Load the object with the given key, or return null if not cached.
+  public: std::unique_ptr<llvm::MemoryBuffer> load(std::string const &key);
+
+  /// Write the given object to the cache under the given key.
+  public: void store(std::string const &key, llvm::MemoryBufferRef obj);
+
+  /**
+   * @brief Create a compile function that caches the objects of the given one.
+   * The created function must only be used while this cache is alive.
+   */
+  public: std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> createCompiler(
+    std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler> compiler
+  );
+
+  public: Word getHitCount() const
+  {
+    return this->hitCount;
+  }
+
+  public: Word getMissCount() const
+  {
+    return this->missCount;
+  }
+
+  private: std::string getFilePath(std::string const &key) const;
+
+}; // class
+
+} // namespace
+
+#endif
@@ -19,9 +19,19 @@ void LazyJitBuildTarget::setupBuild()
 {
   BuildTarget::setupBuild();
 
+  if (this->codeShared) {
+    // Other targets still call into the code compiled by the current engine, so it needs to stay alive.
+    this->retiredJitEngines.push_back(std::move(this->llvmJitEngine));
+    this->retiredTsContexts.push_back(std::move(this->llvmTsContext));
+    this->codeShared = false;
+  }
   this->llvmJitEngine.reset();
 
-  this->llvmJitEngine = llvm::cantFail(LazyJitEngineBuilder().setNumCompileThreads(1).create(this->globalItemRepo));
+  this->llvmJitEngine = llvm::cantFail(
+    LazyJitEngineBuilder()
+      .setNumCompileThreads(this->compileThreadCount > 0 ? this->compileThreadCount : 1)
+      .create(this->globalItemRepo)
+  );
   this->llvmDataLayout = const_cast<llvm::DataLayout*>(&this->llvmJitEngine->getDataLayout());
 
   this->llvmModule.reset();
@@ -66,13 +76,44 @@ void LazyJitBuildTarget::addLlvmModule(std::unique_ptr<llvm::Module> module)
 }
 
 
+LazyJitEngine* LazyJitBuildTarget::shareEngine()
+{
+  this->codeShared = true;
+  return this->llvmJitEngine.get();
+}
+
+
+llvm::JITTargetAddress LazyJitBuildTarget::lookupFunction(LazyJitEngine *engine, llvm::StringRef name)
+{
+  auto symbol = engine->lookup(name);
+  if (!symbol) {
+    llvm::consumeError(symbol.takeError());
+    return 0;
+  }
+  return symbol->getAddress();
+}
+
+
+void LazyJitBuildTarget::releaseSharedCode()
+{
+  this->codeShared = false;
+  this->retiredJitEngines.clear();
+  this->retiredTsContexts.clear();
+}
+
+
 void LazyJitBuildTarget::execute(Char const *entry)
 {
   if (this->llvmModule != 0) this->addLlvmModule(std::move(this->llvmModule));
 
   typedef void (*FuncType)();
-  auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
-  auto funcPtr = (FuncType)llvmEntry.getAddress();
+  FuncType funcPtr;
+  {
+    // Looking up the entry is what triggers compiling the added modules.
+    TIME_PHASE(CODE_EMISSION);
+    auto llvmEntry = llvm::cantFail(this->llvmJitEngine->lookup(entry));
+    funcPtr = (FuncType)llvmEntry.getAddress();
+  }
 
   funcPtr();
 }
@@ -35,6 +35,16 @@ class LazyJitBuildTarget : public BuildTarget
 
   private: CodeGen::GlobalItemRepo *globalItemRepo = 0;
 
+  /// The number of threads used to compile functions, which must be at least 1.
+  private: Word compileThreadCount = 1;
+
+  /// Whether other targets linked to functions compiled by the current engine.
+  private: std::atomic<Bool> codeShared = false;
+
+  /// Engines replaced by setupBuild that other targets still link to, until they call releaseSharedCode.
+  private: std::vector<std::unique_ptr<LazyJitEngine>> retiredJitEngines;
+  private: std::vector<std::unique_ptr<llvm::orc::ThreadSafeContext>> retiredTsContexts;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -48,12 +58,24 @@ class LazyJitBuildTarget : public BuildTarget
     this->llvmJitEngine.reset();
     this->llvmModule.reset();
     this->llvmTsContext.reset();
+    this->retiredJitEngines.clear();
+    this->retiredTsContexts.clear();
   }
 
 
   //============================================================================
   // Member Functions
 
+  public: void setCompileThreadCount(Word c)
+  {
+    this->compileThreadCount = c;
+  }
+
+  public: Word getCompileThreadCount() const
+  {
+    return this->compileThreadCount;
+  }
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -75,6 +97,27 @@ class LazyJitBuildTarget : public BuildTarget
 
   public: virtual void addLlvmModule(std::unique_ptr<llvm::Module> module);
 
+  /**
+   * @brief Get the current engine for another target to link to its functions.
+   * The engine is kept alive after setupBuild replaces it, until
+   * releaseSharedCode is called.
+   */
+  public: LazyJitEngine* shareEngine();
+
+  /**
+   * @brief Get the address of the given function in an engine returned by shareEngine.
+   * The function is compiled lazily on its first call.
+   * @return Returns 0 if the function isn't found.
+   */
+  public: static llvm::JITTargetAddress lookupFunction(LazyJitEngine *engine, llvm::StringRef name);
+
+  /**
+   * @brief Notify the target that other targets no longer link to its code.
+   * This is called by the targets using shareEngine when they drop their
+   * compiled code, which releases the engines retired by setupBuild.
+   */
+  public: void releaseSharedCode();
+
   public: void execute(Char const *entry);
 
 }; // class
@@ -109,6 +109,31 @@ void OfflineBuildTarget::generateObjectFile(
 
   this->llvmModule->setTargetTriple(this->targetTriple);
 
+  // Use a target machine tuned for the requested CPU and optimization level. Partitioned output creates its target
+  // machines the same way, so the output is the same whether the module is partitioned or not.
+  auto targetMachine = this->createTunedTargetMachine();
+
+  if (this->optimizationLevel != OptimizationLevel::O0) this->optimizeModule(targetMachine.get());
+
+  if (this->partitionCount > 1) this->emitPartitionedObjectFiles(filename);
+  else OfflineBuildTarget::emitObjectFile(this->llvmModule.get(), targetMachine.get(), filename);
+}
+
+
+std::string OfflineBuildTarget::getPartitionFilename(Char const *filename, Word index)
+{
+  if (index == 0) return filename;
+  llvm::SmallString<256> partitionFilename(filename);
+  llvm::sys::path::replace_extension(partitionFilename, std::to_string(index) + ".o");
+  return partitionFilename.str().str();
+}
+
+
+void OfflineBuildTarget::emitObjectFile(
+  llvm::Module *module, llvm::TargetMachine *targetMachine, Char const *filename
+) {
+  TIME_PHASE(CODE_EMISSION);
+
   std::error_code ec;
   llvm::raw_fd_ostream dest(filename, ec, llvm::sys::fs::F_None);
 
@@ -119,15 +144,131 @@ void OfflineBuildTarget::generateObjectFile(
   llvm::legacy::PassManager pass;
   auto fileType = llvm::CGFT_ObjectFile;
 
-  if (this->targetMachine->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
+  if (targetMachine->addPassesToEmitFile(pass, dest, nullptr, fileType)) {
     throw EXCEPTION(GenericException, S("TheTargetMachine can't emit a file of this type"));
   }
 
-  pass.run(*this->llvmModule);
+  pass.run(*module);
   dest.flush();
 }
 
 
+void OfflineBuildTarget::emitPartitionedObjectFiles(Char const *filename)
+{
+  // LLVM contexts are not thread safe, so each partition is serialized into bitcode here and then loaded into its own
+  // context by the thread that emits it. SplitModule always produces the requested number of partitions and assigns
+  // globals to partitions based on their names only, so the output doesn't depend on the number of threads.
+  // SplitModule consumes the module it splits, so we give it a copy to keep the build target's module intact.
+  std::vector<llvm::SmallString<0>> partitions;
+  auto moduleCopy = llvm::CloneModule(*this->llvmModule);
+  llvm::SplitModule(std::move(moduleCopy), this->partitionCount, [&](std::unique_ptr<llvm::Module> part) {
+    partitions.emplace_back();
+    llvm::raw_svector_ostream stream(partitions.back());
+    llvm::WriteBitcodeToFile(*part, stream);
+  });
+
+  // Target machines are created upfront since each thread needs its own.
+  std::vector<std::unique_ptr<llvm::TargetMachine>> targetMachines;
+  Word threadCount = std::min<Word>(partitions.size(), std::max(std::thread::hardware_concurrency(), 1u));
+  for (Word i = 0; i < threadCount; ++i) targetMachines.push_back(this->createTunedTargetMachine());
+
+  std::atomic<Word> nextPartition(0);
+  std::vector<std::exception_ptr> errors(threadCount);
+  std::vector<std::thread> threads;
+  for (Word t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t]() {
+      try {
+        for (Word i = nextPartition++; i < partitions.size(); i = nextPartition++) {
+          llvm::LLVMContext context;
+          auto buffer = llvm::MemoryBufferRef(
+            llvm::StringRef(partitions[i].data(), partitions[i].size()), "partition"
+          );
+          auto module = llvm::parseBitcodeFile(buffer, context);
+          if (!module) {
+            throw EXCEPTION(GenericException, llvm::toString(module.takeError()).c_str());
+          }
+          OfflineBuildTarget::emitObjectFile(
+            module->get(), targetMachines[t].get(), OfflineBuildTarget::getPartitionFilename(filename, i).c_str()
+          );
+        }
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  for (auto &error : errors) if (error) std::rethrow_exception(error);
+}
+
+
+std::unique_ptr<llvm::TargetMachine> OfflineBuildTarget::createTunedTargetMachine()
+{
+  std::string error;
+  auto target = llvm::TargetRegistry::lookupTarget(this->targetTriple, error);
+  if (!target) {
+    throw EXCEPTION(GenericException, error.c_str());
+  }
+
+  std::string cpu = this->cpu.empty() ? "generic" : this->cpu;
+  llvm::SubtargetFeatures features;
+  if (cpu == "native") {
+    cpu = llvm::sys::getHostCPUName().str();
+    llvm::StringMap<bool> hostFeatures;
+    if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+      for (auto &feature : hostFeatures) features.AddFeature(feature.first(), feature.second);
+    }
+  }
+  for (auto &feature : llvm::SubtargetFeatures(this->features).getFeatures()) features.AddFeature(feature);
+
+  // O0 keeps the default code generation level used by the generic target machine, so that selecting a CPU at O0
+  // only changes the CPU.
+  llvm::CodeGenOpt::Level codeGenLevel;
+  switch (this->optimizationLevel.val) {
+    case OptimizationLevel::O1: codeGenLevel = llvm::CodeGenOpt::Less; break;
+    case OptimizationLevel::O3: codeGenLevel = llvm::CodeGenOpt::Aggressive; break;
+    default: codeGenLevel = llvm::CodeGenOpt::Default;
+  }
+
+  llvm::TargetOptions opt;
+  auto rm = llvm::Optional<llvm::Reloc::Model>();
+  return std::unique_ptr<llvm::TargetMachine>(target->createTargetMachine(
+    this->targetTriple, cpu, features.getString(), opt, rm, llvm::None, codeGenLevel
+  ));
+}
+
+
+void OfflineBuildTarget::optimizeModule(llvm::TargetMachine *tm)
+{
+  TIME_PHASE(OPTIMIZATION);
+
+  // Vectorization is only enabled from O2 upwards, similar to clang.
+  llvm::PipelineTuningOptions tuningOptions;
+  tuningOptions.LoopVectorization = this->optimizationLevel >= OptimizationLevel::O2;
+  tuningOptions.SLPVectorization = this->optimizationLevel >= OptimizationLevel::O2;
+  llvm::PassBuilder passBuilder(tm, tuningOptions);
+
+  llvm::LoopAnalysisManager lam;
+  llvm::FunctionAnalysisManager fam;
+  llvm::CGSCCAnalysisManager cgam;
+  llvm::ModuleAnalysisManager mam;
+  passBuilder.registerModuleAnalyses(mam);
+  passBuilder.registerCGSCCAnalyses(cgam);
+  passBuilder.registerFunctionAnalyses(fam);
+  passBuilder.registerLoopAnalyses(lam);
+  passBuilder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  llvm::PassBuilder::OptimizationLevel level;
+  switch (this->optimizationLevel.val) {
+    case OptimizationLevel::O1: level = llvm::PassBuilder::OptimizationLevel::O1; break;
+    case OptimizationLevel::O2: level = llvm::PassBuilder::OptimizationLevel::O2; break;
+    case OptimizationLevel::O3: level = llvm::PassBuilder::OptimizationLevel::O3; break;
+    default: level = llvm::PassBuilder::OptimizationLevel::Os;
+  }
+  llvm::ModulePassManager mpm = passBuilder.buildPerModuleDefaultPipeline(level);
+  mpm.run(*this->llvmModule, mam);
+}
+
+
 void OfflineBuildTarget::buildCtorOrDtorArray(Array<Str> const *funcNames, Char const *globalVarName)
 {
   // Make sure the global llvm module exists.
@@ -13,6 +13,8 @@
 #ifndef SPP_LLVMCODEGEN_OFFLINEBUILDTARGET_H
 #define SPP_LLVMCODEGEN_OFFLINEBUILDTARGET_H
 
+#include <thread>
+
 namespace Spp::LlvmCodeGen
 {
 
@@ -27,6 +29,12 @@ class OfflineBuildTarget : public BuildTarget
   //============================================================================
   // Types
 
+  /**
+   * @brief Optimization levels of generated object files.
+   * The values must match those of Spp.OptimizationLevel in Spp.alusus.
+   */
+  public: s_enum(OptimizationLevel, O0 = 0, O1 = 1, O2 = 2, O3 = 3, OS = 4);
+
   private: struct LlvmGlobalCtorDtorEntryTypes
   {
     llvm::PointerType *llvmFuncPtrType = 0;
@@ -39,6 +47,11 @@ class OfflineBuildTarget : public BuildTarget
   // Member Variables
 
   private: std::string targetTriple;
+  private: OptimizationLevel optimizationLevel;
+  /// The CPU to tune for. Empty for generic code, or "native" for the host CPU.
+  private: std::string cpu;
+  private: std::string features;
+  private: Word partitionCount;
   private: std::unique_ptr<llvm::TargetMachine> targetMachine;
   private: std::unique_ptr<llvm::DataLayout> llvmDataLayout;
   private: std::unique_ptr<llvm::LLVMContext> llvmContext;
@@ -49,7 +62,7 @@ class OfflineBuildTarget : public BuildTarget
   //============================================================================
   // Constructors & Destructor
 
-  public: OfflineBuildTarget()
+  public: OfflineBuildTarget() : optimizationLevel(OptimizationLevel::O0), partitionCount(1)
   {
     this->setTargetTriple(0);
   }
@@ -75,6 +88,65 @@ class OfflineBuildTarget : public BuildTarget
     return this->targetTriple;
   }
 
+  public: static Bool isValidOptimizationLevel(Int level)
+  {
+    return level >= OptimizationLevel::O0 && level <= OptimizationLevel::OS;
+  }
+
+  public: void setOptimizationLevel(Int level)
+  {
+    if (!OfflineBuildTarget::isValidOptimizationLevel(level)) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Invalid optimization level."), level);
+    }
+    this->optimizationLevel = level;
+  }
+
+  public: OptimizationLevel getOptimizationLevel() const
+  {
+    return this->optimizationLevel;
+  }
+
+  /**
+   * @brief Set the CPU and the features to generate code for.
+   * Passing null or an empty string keeps the generic CPU. Passing "native" as
+   * the CPU targets the host CPU, including all of its features, in which case
+   * the given features are appended to the host's features.
+   */
+  public: void setCpu(Char const *c, Char const *f)
+  {
+    this->cpu = c == 0 ? "" : c;
+    this->features = f == 0 ? "" : f;
+  }
+
+  public: std::string const& getCpu() const
+  {
+    return this->cpu;
+  }
+
+  public: std::string const& getFeatures() const
+  {
+    return this->features;
+  }
+
+  /**
+   * @brief Set the number of object files to split the generated code into.
+   * When more than one partition is requested the module is split and the
+   * partitions are emitted concurrently. Partition 0 is written to the given
+   * filename and the others to the names returned by getPartitionFilename.
+   */
+  public: void setPartitionCount(Word count)
+  {
+    this->partitionCount = count == 0 ? 1 : count;
+  }
+
+  public: Word getPartitionCount() const
+  {
+    return this->partitionCount;
+  }
+
+  /// Get the name of the object file of the given partition, e.g. output.2.o for output.o.
+  public: static std::string getPartitionFilename(Char const *filename, Word index);
+
   public: virtual void setupBuild();
 
   public: virtual llvm::DataLayout* getLlvmDataLayout()
@@ -102,6 +174,14 @@ class OfflineBuildTarget : public BuildTarget
     Char const *filename, Array<Str> const *ctorNames, Array<Str> const *dtorNames
   );
 
+  private: std::unique_ptr<llvm::TargetMachine> createTunedTargetMachine();
+
+  private: void optimizeModule(llvm::TargetMachine *tm);
+
+  private: static void emitObjectFile(llvm::Module *module, llvm::TargetMachine *targetMachine, Char const *filename);
+
+  private: void emitPartitionedObjectFiles(Char const *filename);
+
   private: void buildCtorOrDtorArray(Array<Str> const *funcNames, Char const *globalVarName);
 
 }; // class
@@ -39,6 +39,7 @@ void TargetGenerator::initBindings()
   targetGeneration->prepareFunctionBody = &TargetGenerator::prepareFunctionBody;
   targetGeneration->finishFunctionBody = &TargetGenerator::finishFunctionBody;
   targetGeneration->deleteFunction = &TargetGenerator::deleteFunction;
+  targetGeneration->linkSharedFunction = &TargetGenerator::linkSharedFunction;
 
   // Variable Definition Generation Functions
   targetGeneration->generateGlobalVariable = &TargetGenerator::generateGlobalVariable;
@@ -520,6 +521,13 @@ Bool TargetGenerator::deleteFunction(TiObject *function)
 }
 
 
+Bool TargetGenerator::linkSharedFunction(TiObject *function)
+{
+  PREPARE_ARG(function, funcWrapper, Function);
+  return this->buildTarget->linkSharedFunction(funcWrapper->getName());
+}
+
+
 //==============================================================================
 // Variable Definition Generation Functions
 
@@ -139,6 +139,8 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: Bool deleteFunction(TiObject *function);
 
+  public: Bool linkSharedFunction(TiObject *function);
+
   /// @}
 
   /// @name Variable Definition Generation Functions
@@ -53,6 +53,20 @@ Error JitEngineBuilderState::prepareForConstruction() {
 JitEngine::~JitEngine() {
   if (compileThreads)
     compileThreads->wait();
+
+  if (objectCache) {
+    LOG(
+      Spp::LogLevel::LLVMCODEGEN_DIAGNOSTIC,
+      S("JIT object cache: ") << objectCache->getHitCount() << S(" hits, ") << objectCache->getMissCount() << S(" misses")
+    );
+  }
+}
+
+
+Word JitEngine::getDefaultCompileThreadCount() {
+  Char const *threads = getenv(S("ALUSUS_JIT_THREADS"));
+  if (threads != 0 && getStrLen(threads) > 0 && atoi(threads) >= 0) return atoi(threads);
+  return std::thread::hardware_concurrency();
 }
 
 
@@ -69,6 +83,14 @@ Error JitEngine::addIRModule(JITDylib &jd, ThreadSafeModule tsm) {
   if (auto err = tsm.withModuleDo([&](Module &m) { return applyDataLayout(m); }))
     return err;
 
+  // Look up the cache before optimizing the module so that cache hits skip
+  // both optimization and compilation.
+  if (objectCache) {
+    std::unique_ptr<MemoryBuffer> obj;
+    tsm.withModuleDo([&](Module &m) { obj = objectCache->lookup(m); });
+    if (obj) return addObjectFile(jd, std::move(obj));
+  }
+
   if (optimizeLayer.get() != 0) {
     return optimizeLayer->add(jd, std::move(tsm), es->allocateVModule());
   } else {
@@ -116,11 +138,20 @@ std::unique_ptr<ObjectLayer> JitEngine::createObjectLinkingLayer(JitEngineBuilde
 
 
 Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> JitEngine::createCompileFunction(
-  JitEngineBuilderState &s, JITTargetMachineBuilder jtmb
+  JitEngineBuilderState &s, JITTargetMachineBuilder jtmb, JitObjectCache *cache
 ) {
+  // Objects are cached by wrapping the compile function, so the compile
+  // function itself is given no LLVM object cache.
+  if (cache) {
+    auto compileFunction = createCompileFunction(s, std::move(jtmb), 0);
+    if (!compileFunction)
+      return compileFunction.takeError();
+    return cache->createCompiler(std::move(*compileFunction));
+  }
+
   /// If there is a custom compile function creator set then use it.
   if (s.createCompileFunction)
-    return s.createCompileFunction(std::move(jtmb));
+    return s.createCompileFunction(std::move(jtmb), nullptr);
 
   // Otherwise default to creating a SimpleCompiler, or ConcurrentIRCompiler,
   // depending on the number of threads requested.
@@ -151,8 +182,11 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
     return;
   }
 
+  if (JitObjectCache::isEnabled(s.useObjectCache))
+    objectCache = JitObjectCache::create(*s.jtmb, useOptimizeLayer);
+
   {
-    auto compileFunction = createCompileFunction(s, std::move(*s.jtmb));
+    auto compileFunction = createCompileFunction(s, std::move(*s.jtmb), objectCache.get());
     if (!compileFunction) {
       err = compileFunction.takeError();
       return;
@@ -176,6 +210,9 @@ JitEngine::JitEngine(JitEngineBuilderState &s, Error &err, Bool useOptimizeLayer
 
   if (useOptimizeLayer) {
     optimizeLayer = createOptimizeLayer(*compileLayer);
+    // Give each module its own context so that modules can be optimized
+    // concurrently rather than serializing on the shared context's lock.
+    if (s.numCompileThreads > 0) optimizeLayer->setCloneToNewContextOnEmit(true);
   }
 }
 
@@ -184,18 +221,27 @@ std::unique_ptr<llvm::orc::IRTransformLayer> JitEngine::createOptimizeLayer(llvm
   auto optimizeLayer = std::make_unique<IRTransformLayer>(*es, prevLayer);
 
   static llvm::Expected<llvm::orc::JITTargetMachineBuilder> tmb = llvm::orc::JITTargetMachineBuilder::detectHost();
-  static std::unique_ptr<llvm::TargetMachine> targetMachine = std::move(tmb.get().createTargetMachine().get());
-  static llvm::PassManagerBuilder builder;
-  builder.OptLevel = 3; // TODO: what is the most appropriate level to use?
-  builder.SizeLevel = 0;
-  builder.Inliner = llvm::createFunctionInliningPass(3, 0, false);
-  builder.LoopVectorize = true;
-  builder.SLPVectorize = true;
-  targetMachine->adjustPassManager(builder);
 
   optimizeLayer->setTransform(
-    [&](llvm::orc::ThreadSafeModule tsm, const llvm::orc::MaterializationResponsibility &r) {
+    [](llvm::orc::ThreadSafeModule tsm, const llvm::orc::MaterializationResponsibility &r) {
+      // Modules can be optimized on multiple compile threads at the same time,
+      // and target machines are not thread safe, so each thread gets its own.
+      static thread_local std::unique_ptr<llvm::TargetMachine> targetMachine =
+        std::move(tmb.get().createTargetMachine().get());
+
       tsm.withModuleDo([&](llvm::Module &module) {
+        TIME_PHASE(OPTIMIZATION);
+
+        // The builder is recreated for each module since populating the pass
+        // managers takes ownership of the inliner pass.
+        llvm::PassManagerBuilder builder;
+        builder.OptLevel = 3; // TODO: what is the most appropriate level to use?
+        builder.SizeLevel = 0;
+        builder.Inliner = llvm::createFunctionInliningPass(3, 0, false);
+        builder.LoopVectorize = true;
+        builder.SLPVectorize = true;
+        targetMachine->adjustPassManager(builder);
+
         llvm::legacy::PassManager passes;
         passes.add(new llvm::TargetLibraryInfoWrapperPass(targetMachine->getTargetTriple()));
         passes.add(llvm::createTargetTransformInfoWrapperPass(targetMachine->getTargetIRAnalysis()));
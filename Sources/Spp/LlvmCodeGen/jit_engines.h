@@ -30,6 +30,8 @@ class JitEngine
 
   protected: std::unique_ptr<llvm::orc::ObjectLayer> objLinkingLayer;
   protected: llvm::orc::ObjectTransformLayer objTransformLayer;
+  /// The on-disk cache of compiled objects, or null if caching is not used.
+  protected: std::unique_ptr<JitObjectCache> objectCache;
   protected: std::unique_ptr<llvm::orc::IRCompileLayer> compileLayer;
   protected: std::unique_ptr<llvm::orc::IRTransformLayer> optimizeLayer;
 
@@ -48,6 +50,10 @@ class JitEngine
 
   public: static llvm::Expected<std::unique_ptr<JitEngine>> Create(JitEngineBuilderState &s);
 
+  /// Returns the compile thread count specified by ALUSUS_JIT_THREADS, or the
+  /// number of CPU cores if not specified.
+  public: static Word getDefaultCompileThreadCount();
+
 
   //============================================================================
   // Member Functions
@@ -139,6 +145,11 @@ class JitEngine
     return objTransformLayer;
   }
 
+  /// Returns the object cache of this instance, or null if not using one.
+  public: JitObjectCache* getObjectCache() {
+    return objectCache.get();
+  }
+
   protected: static std::unique_ptr<llvm::orc::ObjectLayer> createObjectLinkingLayer(
     JitEngineBuilderState &s, llvm::orc::ExecutionSession &es
   );
@@ -146,7 +157,7 @@ class JitEngine
   protected: std::unique_ptr<llvm::orc::IRTransformLayer> createOptimizeLayer(llvm::orc::IRLayer &prevLayer);
 
   protected: static llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> createCompileFunction(
-    JitEngineBuilderState &s, llvm::orc::JITTargetMachineBuilder jtmb
+    JitEngineBuilderState &s, llvm::orc::JITTargetMachineBuilder jtmb, JitObjectCache *cache
   );
 
   protected: std::string mangle(llvm::StringRef unmangledName);
@@ -213,13 +224,18 @@ class JitEngineBuilderState
 
   public: using CompileFunctionCreator =
       std::function<llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>>(
-          llvm::orc::JITTargetMachineBuilder jtmb)>;
+          llvm::orc::JITTargetMachineBuilder jtmb, llvm::ObjectCache *cache)>;
+
+  /// Returns the address of the given shared symbol, or 0 if not shared.
+  public: using SharedSymbolLookup = std::function<llvm::JITTargetAddress(llvm::StringRef name)>;
 
   public: std::unique_ptr<llvm::orc::ExecutionSession> es;
   public: llvm::Optional<llvm::orc::JITTargetMachineBuilder> jtmb;
   public: ObjectLinkingLayerCreator createObjectLinkingLayer;
   public: CompileFunctionCreator createCompileFunction;
   public: unsigned numCompileThreads = 0;
+  public: Bool useObjectCache = false;
+  public: SharedSymbolLookup sharedSymbolLookup;
 
   /// Called prior to JIT class construcion to fix up defaults.
   public: llvm::Error prepareForConstruction();
@@ -257,6 +273,37 @@ class GlobalMappingGenerator : public llvm::orc::JITDylib::DefinitionGenerator {
 };
 
 
+//==============================================================================
+/// Resolves symbols compiled by another engine, like functions shared by the
+/// preprocess build target with the JIT build target.
+class SharedSymbolGenerator : public llvm::orc::JITDylib::DefinitionGenerator {
+  private: JitEngineBuilderState::SharedSymbolLookup lookup;
+
+  public: SharedSymbolGenerator(JitEngineBuilderState::SharedSymbolLookup lookup) : lookup(std::move(lookup)) {}
+
+  llvm::Error tryToGenerate(
+    llvm::orc::LookupKind K, llvm::orc::JITDylib &JD, llvm::orc::JITDylibLookupFlags JDLookupFlags,
+    const llvm::orc::SymbolLookupSet &Names
+  ) {
+    llvm::orc::SymbolMap NewDefs;
+
+    for (const auto &KV : Names) {
+      const auto &Name = KV.first;
+      #if __APPLE__
+        // Skip the leading _ that gets auto added in macOS.
+        auto address = this->lookup((*Name).substr(1));
+      #else
+        auto address = this->lookup(*Name);
+      #endif
+      if (address != 0) NewDefs[Name] = llvm::JITEvaluatedSymbol(address, llvm::JITSymbolFlags::None);
+    }
+
+    if (!NewDefs.empty()) cantFail(JD.define(absoluteSymbols(std::move(NewDefs))));
+    return llvm::Error::success();
+  }
+};
+
+
 //==============================================================================
 template <typename JIT_TYPE, typename SETTER_IMPL, typename STATE>
 class JitEngineBuilderSetters
@@ -311,6 +358,24 @@ class JitEngineBuilderSetters
     return impl();
   }
 
+  /// Enable or disable caching compiled objects on disk.
+  ///
+  /// If this method is not called, compiled objects will not be cached.
+  public: SETTER_IMPL& setUseObjectCache(Bool useObjectCache) {
+    impl().useObjectCache = useObjectCache;
+    return impl();
+  }
+
+  /// Set a function for resolving symbols compiled by another engine.
+  ///
+  /// The function is consulted for symbols that aren't defined in the main
+  /// JITDylib nor in the global item repo, before searching the current
+  /// process.
+  public: SETTER_IMPL& setSharedSymbolLookup(JitEngineBuilderState::SharedSymbolLookup lookup) {
+    impl().sharedSymbolLookup = std::move(lookup);
+    return impl();
+  }
+
   /// Create an instance of the JIT.
   public: llvm::Expected<std::unique_ptr<JIT_TYPE>> create(CodeGen::GlobalItemRepo *itemRepo) {
     if (auto err = impl().prepareForConstruction())
@@ -322,6 +387,9 @@ class JitEngineBuilderSetters
       return std::move(err);
 
     j->getMainJITDylib().addGenerator(std::make_unique<GlobalMappingGenerator>(itemRepo));
+    if (impl().sharedSymbolLookup) {
+      j->getMainJITDylib().addGenerator(std::make_unique<SharedSymbolGenerator>(std::move(impl().sharedSymbolLookup)));
+    }
     j->getMainJITDylib().addGenerator(llvm::cantFail(
       llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(j->getDataLayout().getGlobalPrefix())
     ));
@@ -306,6 +306,9 @@ DEFINE_NOTICE(CircularGlobalVarInitNotice, "Spp.Notices", "Spp", "alusus.org", "
 DEFINE_NOTICE(UnexpectedTerminalStatementNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1043", 1,
   "Unexpected terminal statement encountered."
 );
+DEFINE_NOTICE(InvalidOptimizationLevelNotice, "Spp.Notices", "Spp", "alusus.org", "SPPG1044", 1,
+  "Invalid optimization level."
+);
 
 } // namespace
 
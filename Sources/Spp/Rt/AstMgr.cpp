@@ -240,11 +240,11 @@ String AstMgr::_getSourceFullPathForElement(TiObject *self, TiObject *element)
 {
   auto sourceLocation = Core::Data::Ast::findSourceLocation(element).get();
   if (sourceLocation->isDerivedFrom<Core::Data::SourceLocationRecord>()) {
-    return static_cast<Core::Data::SourceLocationRecord*>(sourceLocation)->filename;
+    return static_cast<Core::Data::SourceLocationRecord*>(sourceLocation)->getFilename();
   } else {
     auto stack = static_cast<Core::Data::SourceLocationStack*>(sourceLocation);
     sourceLocation = stack->get(0).get();
-    return static_cast<Core::Data::SourceLocationRecord*>(sourceLocation)->filename;
+    return static_cast<Core::Data::SourceLocationRecord*>(sourceLocation)->getFilename();
   }
 }
 
@@ -22,6 +22,8 @@ void BuildMgr::initBindingCaches()
   Basic::initBindingCaches(this, {
     &this->dumpLlvmIrForElement,
     &this->buildObjectFileForElement,
+    &this->buildObjectFileForElementWithOptions,
+    &this->buildObjectFilesForElement,
     &this->raiseBuildNotice
   });
 }
@@ -31,6 +33,8 @@ void BuildMgr::initBindings()
 {
   this->dumpLlvmIrForElement = &BuildMgr::_dumpLlvmIrForElement;
   this->buildObjectFileForElement = &BuildMgr::_buildObjectFileForElement;
+  this->buildObjectFileForElementWithOptions = &BuildMgr::_buildObjectFileForElementWithOptions;
+  this->buildObjectFilesForElement = &BuildMgr::_buildObjectFilesForElement;
   this->raiseBuildNotice = &BuildMgr::_raiseBuildNotice;
 }
 
@@ -40,6 +44,10 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
   globalItemRepo->addItem(S("!Spp.buildMgr"), sizeof(void*), &buildMgr);
   globalItemRepo->addItem(S("Spp_BuildMgr_dumpLlvmIrForElement"), (void*)&BuildMgr::_dumpLlvmIrForElement);
   globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFileForElement"), (void*)&BuildMgr::_buildObjectFileForElement);
+  globalItemRepo->addItem(
+    S("Spp_BuildMgr_buildObjectFileForElementWithOptions"), (void*)&BuildMgr::_buildObjectFileForElementWithOptions
+  );
+  globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFilesForElement"), (void*)&BuildMgr::_buildObjectFilesForElement);
   globalItemRepo->addItem(S("Spp_BuildMgr_raiseBuildNotice"), (void*)&BuildMgr::_raiseBuildNotice);
 }
 
@@ -58,7 +66,31 @@ Bool BuildMgr::_buildObjectFileForElement(
   TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
 ) {
   PREPARE_SELF(buildMgr, BuildMgr);
-  return buildMgr->buildManager->buildObjectFileForElement(element, objectFilename, targetTriple);
+  return buildMgr->buildManager->buildObjectFileForElement(
+    element, objectFilename, targetTriple, LlvmCodeGen::OfflineBuildTarget::OptimizationLevel::O0, 0, 0, 1
+  );
+}
+
+
+Bool BuildMgr::_buildObjectFileForElementWithOptions(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Int optimizationLevel, Char const *cpu, Char const *features
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->buildObjectFileForElement(
+    element, objectFilename, targetTriple, optimizationLevel, cpu, features, 1
+  );
+}
+
+
+Bool BuildMgr::_buildObjectFilesForElement(
+  TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+  Int optimizationLevel, Char const *cpu, Char const *features, Word partitionCount
+) {
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->buildManager->buildObjectFileForElement(
+    element, objectFilename, targetTriple, optimizationLevel, cpu, features, partitionCount
+  );
 }
 
 
@@ -96,6 +96,28 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
     TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple
   );
 
+  public: METHOD_BINDING_CACHE(buildObjectFileForElementWithOptions,
+    Bool, (
+      TiObject* /* element */, Char const* /* objectFilename */, Char const* /* targetTriple */,
+      Int /* optimizationLevel */, Char const* /* cpu */, Char const* /* features */
+    )
+  );
+  public: static Bool _buildObjectFileForElementWithOptions(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Int optimizationLevel, Char const *cpu, Char const *features
+  );
+
+  public: METHOD_BINDING_CACHE(buildObjectFilesForElement,
+    Bool, (
+      TiObject* /* element */, Char const* /* objectFilename */, Char const* /* targetTriple */,
+      Int /* optimizationLevel */, Char const* /* cpu */, Char const* /* features */, Word /* partitionCount */
+    )
+  );
+  public: static Bool _buildObjectFilesForElement(
+    TiObject *self, TiObject *element, Char const *objectFilename, Char const *targetTriple,
+    Int optimizationLevel, Char const *cpu, Char const *features, Word partitionCount
+  );
+
   public: METHOD_BINDING_CACHE(raiseBuildNotice, void, (
     Char const* /* code */, Int /* severity */, TiObject* /* astNode */
   ));
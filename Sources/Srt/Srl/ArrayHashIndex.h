@@ -0,0 +1,146 @@
+/**
+ * @file Srl/ArrayHashIndex.h
+ * Contains the class Srl::ArrayHashIndex.
+ *
+ * @copyright Copyright (C) 2026 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/license.html>.
+ */
+//==============================================================================
+
+#ifndef SRL_ARRAYHASHINDEX_H
+#define SRL_ARRAYHASHINDEX_H
+
+namespace Srl
+{
+
+//==============================================================================
+// Hash Functions
+// These functions must produce the same values as their counterparts in
+// ArrayHashIndex.alusus since hashed maps can be shared with Alusus code.
+
+inline Word getHash(Char const *s) {
+  Word h = 5381;
+  for (; *s != 0; ++s) h = h * 33 + static_cast<Byte>(*s);
+  return h;
+}
+
+inline Word getHash(String const &s) {
+  return getHash(s.getBuf());
+}
+
+inline Word getHash(Int v) {
+  Word h = static_cast<Word>(v);
+  h = h ^ (h >> 16);
+  h = h * 0x45d9f3b;
+  h = h ^ (h >> 16);
+  return h;
+}
+
+inline Word getHash(LongInt v) {
+  return getHash(static_cast<Int>(v ^ (v >> 32)));
+}
+
+
+//==============================================================================
+// ArrayHashIndex
+
+template<class T> class ArrayHashIndex {
+  //=================
+  // Member Variables
+
+  /// Open addressing table of positions within values, -1 for empty slots.
+  private: Array<ArchInt> slots;
+  private: Array<T> *values;
+  /// The number of items from the beginning of values that are indexed.
+  private: ArchInt count;
+  private: Word (*hasher)(T const &v);
+
+  //===============
+  // Initialization
+
+  public: ArrayHashIndex() {
+    this->values = 0;
+    this->count = 0;
+    this->hasher = 0;
+  }
+
+  public: ArrayHashIndex(Array<T> *v) {
+    this->values = v;
+    this->count = 0;
+    this->hasher = &ArrayHashIndex<T>::hash;
+    this->add(-1);
+  }
+
+  //=================
+  // Member Functions
+
+  public: void add(ArchInt i) {
+    if (i == -1) {
+      // Add any new items at the end of the values list.
+      while (this->count < this->values->getLength()) {
+        if ((this->count + 1) * 2 > this->slots.getLength()) {
+          this->rebuild();
+          return;
+        }
+        this->insertSlot(this->count);
+        ++this->count;
+      }
+    } else if (i < this->values->getLength()) {
+      // An item was inserted in the middle, so all following positions changed.
+      this->rebuild();
+    } else {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range"), i);
+    }
+  }
+
+  public: void remove(ArchInt i) {
+    if (i >= this->count) {
+      throw EXCEPTION(InvalidArgumentException, S("i"), S("Out of range"), i);
+    }
+    this->rebuild();
+  }
+
+  public: void clear() {
+    this->slots.clear();
+    this->count = 0;
+  }
+
+  public: ArchInt findPos(T const &v) const {
+    ArchInt size = this->slots.getLength();
+    if (size == 0) return -1;
+    ArchInt pos = static_cast<ArchInt>(this->hasher(v)) & (size - 1);
+    while (this->slots(pos) != -1) {
+      if (this->values->at(this->slots(pos)) == v) return this->slots(pos);
+      pos = (pos + 1) & (size - 1);
+    }
+    return -1;
+  }
+
+  /// Recreate the table from scratch with a size suitable for the current values.
+  private: void rebuild() {
+    ArchInt size = 16;
+    while (size < this->values->getLength() * 2) size *= 2;
+    this->slots = Array<ArchInt>(size, -1);
+    for (this->count = 0; this->count < this->values->getLength(); ++this->count) {
+      this->insertSlot(this->count);
+    }
+  }
+
+  private: void insertSlot(ArchInt i) {
+    ArchInt size = this->slots.getLength();
+    ArchInt pos = static_cast<ArchInt>(this->hasher(this->values->at(i))) & (size - 1);
+    while (this->slots(pos) != -1) pos = (pos + 1) & (size - 1);
+    this->slots(pos) = i;
+  }
+
+  private: static Word hash(T const &v) {
+    return getHash(v);
+  }
+}; // class
+
+} // namespace
+
+#endif
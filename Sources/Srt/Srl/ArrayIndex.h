@@ -16,7 +16,11 @@
 namespace Srl
 {
 
+template<class T1, class T2> class Map;
+
 template<class T> class ArrayIndex {
+  template<class T1, class T2> friend class Map;
+
   //=================
   // Member Variables
 
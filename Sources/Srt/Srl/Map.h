@@ -16,6 +16,13 @@
 namespace Srl
 {
 
+/// The type of index a Map uses to look up keys.
+enum class MapIndexType {
+  NONE = 0,
+  SORTED = 1,
+  HASHED = 2
+};
+
 template<class T1, class T2> class Map {
   //=================
   // Member Variables
@@ -23,27 +30,33 @@ template<class T1, class T2> class Map {
   private: Array<T1> keys;
   private: Array<T2> values;
   private: ArrayIndex<T1> *keysIndex;
+  private: ArrayHashIndex<T1> *keysHashIndex;
 
   //===============
   // Initialization
 
-  public: Map() : keysIndex(0) {
+  public: Map() : keysIndex(0), keysHashIndex(0) {
+  }
+
+  public: Map(Bool useIndex) : Map(useIndex ? MapIndexType::SORTED : MapIndexType::NONE) {
   }
 
-  public: Map(Bool useIndex) {
-    if (useIndex) this->keysIndex = new ArrayIndex<T1>(&this->keys);
-    else this->keysIndex = 0;
+  public: Map(MapIndexType indexType) : keysIndex(0), keysHashIndex(0) {
+    if (indexType == MapIndexType::SORTED) this->keysIndex = new ArrayIndex<T1>(&this->keys);
+    else if (indexType == MapIndexType::HASHED) this->keysHashIndex = new ArrayHashIndex<T1>(&this->keys);
   }
 
   public: Map(Map<T1, T2> const &map) {
     this->keysIndex = 0;
+    this->keysHashIndex = 0;
     this->keys = map.keys;
     this->values = map.values;
   }
 
   public: Map(Map<T1, T2> const &map, Bool useIndex) {
-    this->Keys = map.keys;
+    this->keys = map.keys;
     this->values = map.values;
+    this->keysHashIndex = 0;
     if (useIndex) {
       this->keysIndex = new ArrayIndex<T1>(&this->keys);
       if (map.keysIndex != 0) this->keysIndex->indices = map.keysIndex->indices;
@@ -55,6 +68,7 @@ template<class T1, class T2> class Map {
 
   public: ~Map() {
     if (this->keysIndex != 0) delete this->keysIndex;
+    if (this->keysHashIndex != 0) delete this->keysHashIndex;
   }
 
   //==========
@@ -64,12 +78,16 @@ template<class T1, class T2> class Map {
     this->keys = map.keys;
     this->values = map.values;
     if (this->keysIndex != 0) {
-      if (map.keysIndex != 0) this->keysIndex->indices = map->keysIndex->indices;
+      if (map.keysIndex != 0) this->keysIndex->indices = map.keysIndex->indices;
       else {
         this->keysIndex->clear();
         this->keysIndex->add(-1);
       }
     }
+    if (this->keysHashIndex != 0) {
+      this->keysHashIndex->clear();
+      this->keysHashIndex->add(-1);
+    }
     return *this;
   }
 
@@ -80,6 +98,7 @@ template<class T1, class T2> class Map {
       this->keys.add(key);
       this->values.add(T2());
       if (this->keysIndex != 0) this->keysIndex->add(-1);
+      if (this->keysHashIndex != 0) this->keysHashIndex->add(-1);
     }
     return this->values(i);
   }
@@ -114,6 +133,7 @@ template<class T1, class T2> class Map {
       this->keys.add(key);
       this->values.add(value);
       if (this->keysIndex != 0) this->keysIndex->add(-1);
+      if (this->keysHashIndex != 0) this->keysHashIndex->add(-1);
     } else {
       this->values(pos) = value;
     }
@@ -132,6 +152,7 @@ template<class T1, class T2> class Map {
     this->keys.insert(i, key);
     this->values.insert(i, value);
     if (this->keysIndex != 0) this->keysIndex->add(i);
+    if (this->keysHashIndex != 0) this->keysHashIndex->add(i);
   }
 
   public: Bool remove(T1 const &key) {
@@ -148,12 +169,14 @@ template<class T1, class T2> class Map {
     this->keys.remove(i);
     this->values.remove(i);
     if (this->keysIndex != 0) this->keysIndex->remove(i);
+    if (this->keysHashIndex != 0) this->keysHashIndex->remove(i);
   }
 
   public: void clear() {
     this->keys.clear();
     this->values.clear();
     if (this->keysIndex != 0) this->keysIndex->clear();
+    if (this->keysHashIndex != 0) this->keysHashIndex->clear();
   }
 
   public: ArchInt getLength() const {
@@ -161,7 +184,9 @@ template<class T1, class T2> class Map {
   }
 
   public: ArchInt findPos(T1 const &key) const {
-    if (this->keysIndex == 0) {
+    if (this->keysHashIndex != 0) {
+      return this->keysHashIndex->findPos(key);
+    } else if (this->keysIndex == 0) {
       return this->keys.findPos(key);
     } else {
       return this->keysIndex->findPos(key);
@@ -128,6 +128,7 @@ typedef unsigned long int PtrWord;
 #include "strs.h"
 #include "exceptions.h"
 #include "ArrayIndex.h"
+#include "ArrayHashIndex.h"
 #include "Map.h"
 
 // Since basic datatypes should be available everywhere, we'll just open up the namespace.